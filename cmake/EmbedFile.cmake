@@ -0,0 +1,19 @@
+# Converts a binary file into a C++ translation unit holding its bytes.
+#
+# Usage: cmake -DINPUT=<file> -DOUTPUT=<file.cpp> -DSYMBOL=<name> -P EmbedFile.cmake
+#
+# The generated file defines:
+#   extern const unsigned char <SYMBOL>[];
+#   extern const std::size_t <SYMBOL>_SIZE;
+
+file(READ "${INPUT}" hexContent HEX)
+file(SIZE "${INPUT}" fileSize)
+
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," byteList "${hexContent}")
+string(REGEX REPLACE "(0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,0x..,)" "\\1\n    " byteList "${byteList}")
+
+file(WRITE "${OUTPUT}"
+"// Generated from ${INPUT} by EmbedFile.cmake, do not edit.\n\n"
+"#include <cstddef>\n\n"
+"extern const unsigned char ${SYMBOL}[] = {\n    ${byteList}\n};\n\n"
+"extern const std::size_t ${SYMBOL}_SIZE = ${fileSize};\n")
@@ -0,0 +1,70 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BallType.h"
+#include <limits>
+
+const float PIXELS_PER_M = 57.78f;
+const float AIR_DENSITY = 1.225f;
+const float AIR_VISCOSITY = 1.81e-5f;
+const float PI = 3.14159265359f;
+
+static std::vector<BallType> buildTypes() {
+    std::vector<BallType> types = {
+        // name                 max mass  radius   Cd     COR    rest  color
+        {"ping pong",           0.003f,   0.020f,  0.0f,  0.89f, 1.0f, sf::Color(255, 255, 255)}, // ~2.7g for a standard ping pong ball
+        {"racquet ball",        0.05f,    0.0285f, 0.0f,  0.80f, 2.0f, sf::Color(60, 120, 255)},  // ~40g for a standard racquet ball
+        {"tennis ball",         0.065f,   0.0335f, 0.55f, 0.75f, 2.0f, sf::Color(200, 255, 60)},  // ~56-59.4g for a standard tennis ball
+        {"baseball",            0.16f,    0.0365f, 0.35f, 0.55f, 2.0f, sf::Color(240, 230, 210)}, // ~142-149g for a standard baseball
+        {"soccer ball",         0.5f,     0.11f,   0.25f, 0.80f, 2.0f, sf::Color(180, 180, 180)}, // ~410-450g for a standard size 5 soccer ball
+        {"basketball",          0.7f,     0.12f,   0.54f, 0.80f, 2.0f, sf::Color(255, 140, 0)},   // ~567-650g for a standard size 7 basketball
+        {"bowling ball",        8.0f,     0.108f,  0.0f,  0.20f, 3.0f, sf::Color(120, 40, 160)},  // Up to ~7.26kg for a heavy bowling ball or shot put
+        {"light medicine ball", 20.0f,    0.15f,   0.0f,  0.30f, 3.0f, sf::Color(150, 90, 40)},   // Common range for heavier medicine balls
+        {"heavy medicine ball", 50.0f,    0.18f,   0.0f,  0.20f, 4.0f, sf::Color(100, 60, 30)},   // Range for very heavy medicine balls or specialized training balls
+        {"industrial ball",     100.0f,   0.25f,   0.0f,  0.10f, 4.0f, sf::Color(90, 90, 90)},    // Up to 100kg for extremely heavy training balls or industrial spherical objects
+        {"extremely heavy / undefined ball", std::numeric_limits<float>::infinity(),
+                                          0.30f,   0.0f,  0.10f, 4.0f, sf::Color(60, 60, 60)},    // For any mass greater than 100kg
+    };
+
+    for (BallType& type : types) {
+        type.crossSection = PI * type.radius * type.radius;
+        type.reynoldsFactor = AIR_DENSITY * 2.0f * type.radius / AIR_VISCOSITY;
+        type.pixelRadius = type.radius * PIXELS_PER_M;
+    }
+    return types;
+}
+
+const std::vector<BallType>& BallCatalogue::getTypes() {
+    static const std::vector<BallType> types = buildTypes();
+    return types;
+}
+
+std::uint8_t BallCatalogue::classify(float mass) {
+    const std::vector<BallType>& types = getTypes();
+    std::uint8_t index = 0;
+    while (index + 1u < types.size() && mass > types[index].maxMass)
+        ++index;
+    return index;
+}
@@ -0,0 +1,56 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BALLTYPE_H
+#define BALLTYPE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct BallType {
+    std::string name;
+    float maxMass;          // Upper bound of the mass range (kg) mapped to this type
+    float radius;           // m
+    float dragCoefficient;  // Fixed Cd, or 0 to derive it from the Reynolds number
+    float cor;              // Coefficient of restitution
+    float restSpeed;        // Bounces slower than this (pixels/s) stop the ball
+    sf::Color color;
+
+    // Derived from radius once, so per-ball loops only read them
+    float crossSection;
+    float reynoldsFactor;   // Re = speed (m/s) * reynoldsFactor
+    float pixelRadius;      // Contact radius against the floor and obstacles
+};
+
+// Data-driven table of ball types, ordered by mass
+class BallCatalogue {
+public:
+    static const std::vector<BallType>& getTypes();
+    static std::uint8_t classify(float mass);
+};
+
+#endif
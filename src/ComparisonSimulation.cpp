@@ -0,0 +1,215 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ComparisonSimulation.h"
+#include "BallType.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+const int WINDOW_WIDTH = 1280;
+const int WINDOW_HEIGHT = 720;
+const float PIXELS_PER_M = 57.78f;
+const float GRAVITY = 9.81f * PIXELS_PER_M;
+const int PARTICLE_SIZE = 12;
+const unsigned int LABEL_CHARACTER_SIZE = 14; // Preloaded by FontLoader
+const float LABEL_TOP = 40.0f;
+
+static std::string formatSeconds(float seconds) {
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2) << seconds << "s";
+    return ss.str();
+}
+
+ComparisonSimulation::ComparisonSimulation(sf::RenderWindow& window, const sf::Font& font, const std::vector<LaneConfig>& configs)
+    : window(window), font(font), uiManager(font), laneRenderer(font, LABEL_CHARACTER_SIZE),
+      simulationFinished(false), gameStarted(false), isPaused(false), timeString("") {
+
+    laneWidth = static_cast<float>(WINDOW_WIDTH) / configs.size();
+    ballRadius = std::min(static_cast<float>(PARTICLE_SIZE), laneWidth * 0.4f);
+    floorY = WINDOW_HEIGHT - ballRadius;
+
+    std::size_t longestLabel = 0;
+    for (std::size_t i = 0; i < configs.size(); ++i) {
+        const LaneConfig& config = configs[i];
+        float x = laneWidth * (i + 0.5f);
+        float startY = floorY - config.height * PIXELS_PER_M;
+
+        std::ostringstream label;
+        label << std::setprecision(3) << config.mass << "kg " << config.height << "m";
+        longestLabel = std::max(longestLabel, label.str().size());
+
+        lanes.push_back({config, Particle(x, startY, config.mass), startY, false, false, 0.0f, 0.0f, label.str()});
+    }
+
+    // Narrow lanes cannot fit a horizontal label, so their readouts run down the lane
+    verticalLabels = laneRenderer.measureText(std::string(longestLabel, '0')) > laneWidth - 2.0f;
+}
+
+void ComparisonSimulation::resetLanes() {
+    for (Lane& lane : lanes) {
+        lane.particle = Particle(lane.particle.position.x, lane.startY, lane.config.mass);
+        lane.hasTouchedGround = false;
+        lane.finished = false;
+        lane.timeToFirstContact = 0.0f;
+        lane.totalTime = 0.0f;
+    }
+    simulationFinished = false;
+    totalClock.restart();
+    frameClock.restart();
+}
+
+void ComparisonSimulation::stepLanes(float deltaTime, float time) {
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+
+    threadPool.parallelFor(lanes.size(), [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Lane& lane = lanes[i];
+            if (lane.finished)
+                continue;
+
+            Particle& particle = lane.particle;
+            const BallType& ballType = ballTypes[particle.type];
+
+            sf::Vector2f gravityForce(0.f, GRAVITY * particle.mass);
+            particle.applyForce(gravityForce);
+            particle.applyDrag(deltaTime, ballType, false);
+            particle.update(deltaTime);
+
+            if (particle.position.y > floorY) {
+                particle.position.y = floorY;
+
+                if (!lane.hasTouchedGround) {
+                    lane.hasTouchedGround = true;
+                    lane.timeToFirstContact = time;
+                }
+
+                float impactSpeed = std::abs(particle.velocity.y);
+                // Gravity adds GRAVITY * deltaTime per frame, which would keep a resting ball bouncing
+                if (impactSpeed > ballType.restSpeed + GRAVITY * deltaTime) {
+                    particle.velocity.y = -particle.velocity.y * ballType.cor;
+                } else {
+                    particle.velocity.y = 0.f;
+                    lane.finished = true;
+                    lane.totalTime = time;
+                }
+            }
+        }
+    });
+
+    simulationFinished = std::all_of(lanes.begin(), lanes.end(), [](const Lane& lane) { return lane.finished; });
+}
+
+void ComparisonSimulation::drawLanes() {
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    float lineHeight = laneRenderer.getLineHeight();
+
+    laneRenderer.clear();
+    for (std::size_t i = 0; i < lanes.size(); ++i) {
+        const Lane& lane = lanes[i];
+        float left = laneWidth * i;
+
+        if (i > 0)
+            laneRenderer.addLine(sf::Vector2f(left, LABEL_TOP), sf::Vector2f(left, WINDOW_HEIGHT), sf::Color(80, 80, 80));
+
+        std::string contact = lane.hasTouchedGround ? formatSeconds(lane.timeToFirstContact) : "-";
+        std::string total = lane.finished ? formatSeconds(lane.totalTime) : "-";
+        sf::Vector2f labelPosition(left + 2.0f, LABEL_TOP);
+
+        if (verticalLabels) {
+            laneRenderer.addText(lane.label + " " + contact + " " + total, labelPosition, sf::Color::White, true);
+        } else {
+            laneRenderer.addText(lane.label, labelPosition, sf::Color::White);
+            laneRenderer.addText(contact, labelPosition + sf::Vector2f(0.f, lineHeight), sf::Color::Green);
+            laneRenderer.addText(total, labelPosition + sf::Vector2f(0.f, lineHeight * 2), sf::Color::Green);
+        }
+
+        laneRenderer.addBall(lane.particle.position, ballRadius, ballTypes[lane.particle.type].color);
+    }
+
+    laneRenderer.draw(window);
+    uiManager.drawControls(window);
+    uiManager.drawTime(window, lanes[0].particle, timeString);
+}
+
+void ComparisonSimulation::run() {
+    while (window.isOpen()) {
+        while (const std::optional event = window.pollEvent()) {
+            if (event->is<sf::Event::Closed>() || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape)) {
+                window.close();
+            }
+        }
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Enter) && !gameStarted) {
+            gameStarted = true;
+            resetLanes();
+        }
+
+        if (!gameStarted) {
+            uiManager.drawStartScreen(window);
+            continue;
+        }
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Num0)) {
+            resetLanes();
+            isPaused = false;
+        }
+
+        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Backspace) && !simulationFinished) {
+            isPaused = true;
+            totalClock.stop();
+            frameClock.stop();
+        }
+
+        if (isPaused) {
+            window.clear();
+            drawLanes();
+            uiManager.drawPauseScreen(window);
+
+            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Enter)) {
+                isPaused = false;
+                totalClock.start();
+                frameClock.start();
+            }
+            continue;
+        }
+
+        if (!simulationFinished) {
+            // One time stamp per frame keeps every lane's readouts in sync
+            float deltaTime = frameClock.restart().asSeconds();
+            float time = totalClock.getElapsedTime().asSeconds();
+            stepLanes(deltaTime, time);
+
+            std::ostringstream sst;
+            sst << std::fixed << std::setprecision(2) << time << " s";
+            timeString = sst.str();
+        }
+
+        window.clear();
+        drawLanes();
+        window.display();
+    }
+}
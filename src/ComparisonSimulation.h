@@ -0,0 +1,82 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef COMPARISONSIMULATION_H
+#define COMPARISONSIMULATION_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+#include "Particle.h"
+#include "UIManager.h"
+#include "ThreadPool.h"
+#include "LaneRenderer.h"
+#include "SceneLoader.h"
+
+// Runs several independent drops side by side, one lane per configuration.
+// Lanes advance in lock step on the thread pool with a shared clock, so their
+// timing readouts are directly comparable.
+class ComparisonSimulation {
+private:
+    struct Lane {
+        LaneConfig config;
+        Particle particle;
+        float startY;
+        bool hasTouchedGround;
+        bool finished;
+        float timeToFirstContact;
+        float totalTime;
+        std::string label;
+    };
+
+    sf::RenderWindow& window;
+    const sf::Font& font;
+    UIManager uiManager;
+    ThreadPool threadPool;
+    LaneRenderer laneRenderer;
+
+    bool simulationFinished;
+    bool gameStarted;
+    bool isPaused;
+    std::string timeString;
+
+    std::vector<Lane> lanes;
+    float laneWidth;
+    float ballRadius;
+    float floorY;
+    bool verticalLabels;
+    sf::Clock totalClock;
+    sf::Clock frameClock;
+
+    void resetLanes();
+    void stepLanes(float deltaTime, float time);
+    void drawLanes();
+
+public:
+    ComparisonSimulation(sf::RenderWindow& window, const sf::Font& font, const std::vector<LaneConfig>& configs);
+    void run();
+};
+
+#endif
@@ -0,0 +1,130 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ConstraintSolver.h"
+#include <cmath>
+
+const std::size_t MAX_COLORS = 64; // One bit per color in the per-particle masks
+
+ConstraintSolver::ConstraintSolver() : colorStarts(1, 0), sequentialStart(0) {}
+
+void ConstraintSolver::build(const std::vector<DistanceConstraint>& unorderedConstraints, std::size_t particleCount) {
+    // Greedy coloring: each constraint takes the lowest color free at both of its particles
+    std::vector<std::uint64_t> usedColors(particleCount, 0);
+    std::vector<std::uint8_t> colors(unorderedConstraints.size());
+    std::vector<std::size_t> colorSizes(MAX_COLORS + 1, 0);
+
+    for (std::size_t i = 0; i < unorderedConstraints.size(); ++i) {
+        const DistanceConstraint& constraint = unorderedConstraints[i];
+        std::uint64_t used = usedColors[constraint.a] | usedColors[constraint.b];
+        std::size_t color = 0;
+        while (color < MAX_COLORS && (used >> color) & 1u)
+            ++color;
+        if (color < MAX_COLORS) {
+            usedColors[constraint.a] |= std::uint64_t(1) << color;
+            usedColors[constraint.b] |= std::uint64_t(1) << color;
+        }
+        colors[i] = static_cast<std::uint8_t>(color);
+        ++colorSizes[color];
+    }
+
+    // Counting sort by color into one flat array
+    std::size_t colorCount = 0;
+    for (std::size_t color = 0; color < MAX_COLORS; ++color) {
+        if (colorSizes[color] > 0)
+            colorCount = color + 1;
+    }
+
+    std::vector<std::size_t> offsets(MAX_COLORS + 1, 0);
+    for (std::size_t color = 1; color <= MAX_COLORS; ++color)
+        offsets[color] = offsets[color - 1] + colorSizes[color - 1];
+
+    colorStarts.assign(offsets.begin(), offsets.begin() + colorCount + 1);
+    sequentialStart = offsets[MAX_COLORS];
+
+    constraints.resize(unorderedConstraints.size());
+    for (std::size_t i = 0; i < unorderedConstraints.size(); ++i)
+        constraints[offsets[colors[i]]++] = unorderedConstraints[i];
+
+    std::vector<bool> constrained(particleCount, false);
+    for (const DistanceConstraint& constraint : unorderedConstraints) {
+        constrained[constraint.a] = true;
+        constrained[constraint.b] = true;
+    }
+
+    constrainedParticles.clear();
+    for (std::uint32_t particle = 0; particle < particleCount; ++particle) {
+        if (constrained[particle])
+            constrainedParticles.push_back(particle);
+    }
+}
+
+bool ConstraintSolver::isEmpty() const {
+    return constraints.empty();
+}
+
+std::size_t ConstraintSolver::getColorCount() const {
+    return colorStarts.size() - 1;
+}
+
+const std::vector<DistanceConstraint>& ConstraintSolver::getConstraints() const {
+    return constraints;
+}
+
+const std::vector<std::uint32_t>& ConstraintSolver::getConstrainedParticles() const {
+    return constrainedParticles;
+}
+
+void ConstraintSolver::project(std::vector<Particle>& particles, const DistanceConstraint& constraint) {
+    Particle& first = particles[constraint.a];
+    Particle& second = particles[constraint.b];
+
+    sf::Vector2f delta = second.position - first.position;
+    float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+    if (length < 1e-6f)
+        return;
+
+    float firstWeight = 1.0f / first.mass;
+    float secondWeight = 1.0f / second.mass;
+    sf::Vector2f correction = delta * ((length - constraint.restLength) / (length * (firstWeight + secondWeight)));
+
+    first.position += correction * firstWeight;
+    second.position -= correction * secondWeight;
+}
+
+void ConstraintSolver::solve(std::vector<Particle>& particles, int iterations, ThreadPool& threadPool) const {
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        for (std::size_t color = 0; color + 1 < colorStarts.size(); ++color) {
+            std::size_t colorStart = colorStarts[color];
+            threadPool.parallelFor(colorStarts[color + 1] - colorStart, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = colorStart + begin; i < colorStart + end; ++i)
+                    project(particles, constraints[i]);
+            });
+        }
+
+        for (std::size_t i = sequentialStart; i < constraints.size(); ++i)
+            project(particles, constraints[i]);
+    }
+}
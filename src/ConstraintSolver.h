@@ -0,0 +1,63 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONSTRAINTSOLVER_H
+#define CONSTRAINTSOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Particle.h"
+#include "ThreadPool.h"
+
+struct DistanceConstraint {
+    std::uint32_t a;
+    std::uint32_t b;
+    float restLength;
+};
+
+// Position-based dynamics solver for distance constraints.
+// Constraints are graph-colored so that no two constraints of one color share
+// a particle; each color is then projected in parallel without atomics.
+class ConstraintSolver {
+private:
+    std::vector<DistanceConstraint> constraints; // Grouped by color
+    std::vector<std::size_t> colorStarts;        // colorStarts[c]..colorStarts[c + 1] is color c
+    std::size_t sequentialStart;                 // Constraints that did not fit a color, solved serially
+    std::vector<std::uint32_t> constrainedParticles;
+
+    static void project(std::vector<Particle>& particles, const DistanceConstraint& constraint);
+
+public:
+    ConstraintSolver();
+    void build(const std::vector<DistanceConstraint>& unorderedConstraints, std::size_t particleCount);
+    bool isEmpty() const;
+    std::size_t getColorCount() const;
+    const std::vector<DistanceConstraint>& getConstraints() const;
+    const std::vector<std::uint32_t>& getConstrainedParticles() const;
+    void solve(std::vector<Particle>& particles, int iterations, ThreadPool& threadPool) const;
+};
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DensityRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+DensityRenderer::DensityRenderer(ThreadPool& threadPool, unsigned int width, unsigned int height)
+    : threadPool(threadPool), width(width), height(height),
+      workerGrids(threadPool.getWorkerCount(), std::vector<std::uint32_t>(width * height, 0)),
+      workerMaxima(threadPool.getWorkerCount(), 0),
+      pixels(width * height * 4, 0),
+      texture(sf::Vector2u(width, height)),
+      sprite(texture) {
+
+    buildColorMap();
+}
+
+void DensityRenderer::buildColorMap() {
+    // Black -> red -> yellow -> white, so dense areas read like the red balls
+    for (std::size_t i = 0; i < colorMap.size(); ++i) {
+        float t = i / 255.0f;
+        auto channel = [t](float start) {
+            return static_cast<std::uint8_t>(std::clamp((t - start) * 3.0f, 0.0f, 1.0f) * 255.0f);
+        };
+        colorMap[i] = sf::Color(channel(0.0f), channel(1.0f / 3.0f), channel(2.0f / 3.0f));
+    }
+}
+
+void DensityRenderer::update(const std::vector<Particle>& particles) {
+    std::size_t cellCount = static_cast<std::size_t>(width) * height;
+
+    // Histogram: every worker bins its own slice of particles into its own grid
+    threadPool.parallelFor(particles.size(), [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        std::vector<std::uint32_t>& grid = workerGrids[worker];
+        for (std::size_t i = begin; i < end; ++i) {
+            const sf::Vector2f& position = particles[i].position;
+            if (position.x < 0.0f || position.y < 0.0f)
+                continue;
+            unsigned int x = static_cast<unsigned int>(position.x);
+            unsigned int y = static_cast<unsigned int>(position.y);
+            if (x >= width || y >= height)
+                continue;
+            ++grid[y * width + x];
+        }
+    });
+
+    // Reduction: each worker sums a band of cells across all grids into grid 0.
+    // Grids are zeroed as they are consumed, so the next histogram starts clean.
+    threadPool.parallelFor(cellCount, [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        std::vector<std::uint32_t>& total = workerGrids[0];
+        std::uint32_t maximum = 0;
+        for (std::size_t grid = 1; grid < workerGrids.size(); ++grid) {
+            std::vector<std::uint32_t>& partial = workerGrids[grid];
+            for (std::size_t cell = begin; cell < end; ++cell) {
+                total[cell] += partial[cell];
+                partial[cell] = 0;
+            }
+        }
+        for (std::size_t cell = begin; cell < end; ++cell)
+            maximum = std::max(maximum, total[cell]);
+        workerMaxima[worker] = maximum;
+    });
+
+    std::uint32_t maximum = *std::max_element(workerMaxima.begin(), workerMaxima.end());
+    std::fill(workerMaxima.begin(), workerMaxima.end(), 0);
+    float logMaximum = std::log1p(static_cast<float>(std::max<std::uint32_t>(maximum, 1)));
+
+    // Color map on a log scale, otherwise the pile on the floor washes out everything else
+    threadPool.parallelFor(cellCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+        std::vector<std::uint32_t>& total = workerGrids[0];
+        for (std::size_t cell = begin; cell < end; ++cell) {
+            std::size_t index = 0;
+            if (total[cell] > 0)
+                index = 1 + static_cast<std::size_t>(std::log1p(static_cast<float>(total[cell])) / logMaximum * 254.0f);
+            total[cell] = 0;
+            const sf::Color& color = colorMap[index];
+            pixels[cell * 4 + 0] = color.r;
+            pixels[cell * 4 + 1] = color.g;
+            pixels[cell * 4 + 2] = color.b;
+            pixels[cell * 4 + 3] = index == 0 ? 0 : 255; // Empty cells let the scene behind show through
+        }
+    });
+
+    texture.update(pixels.data());
+}
+
+void DensityRenderer::draw(sf::RenderWindow& window) const {
+    window.draw(sprite);
+}
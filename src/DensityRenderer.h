@@ -0,0 +1,61 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DENSITYRENDERER_H
+#define DENSITYRENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Particle.h"
+#include "ThreadPool.h"
+
+// Level-of-detail renderer for scenes too large to draw ball by ball.
+// Positions are binned into a screen-sized histogram, one grid per worker,
+// reduced and color-mapped into a single texture.
+class DensityRenderer {
+private:
+    ThreadPool& threadPool;
+    unsigned int width;
+    unsigned int height;
+
+    std::vector<std::vector<std::uint32_t>> workerGrids;
+    std::vector<std::uint32_t> workerMaxima;
+    std::vector<std::uint8_t> pixels;
+    std::array<sf::Color, 256> colorMap;
+
+    sf::Texture texture;
+    sf::Sprite sprite;
+
+    void buildColorMap();
+
+public:
+    DensityRenderer(ThreadPool& threadPool, unsigned int width, unsigned int height);
+    void update(const std::vector<Particle>& particles);
+    void draw(sf::RenderWindow& window) const;
+};
+
+#endif
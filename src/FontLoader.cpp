@@ -0,0 +1,47 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "FontLoader.h"
+#include <cstddef>
+
+extern const unsigned char ROBOTO_MONO_REGULAR[];
+extern const std::size_t ROBOTO_MONO_REGULAR_SIZE;
+
+// Character sizes used by UIManager and InputHandler
+const unsigned int HUD_CHARACTER_SIZES[] = {14, 20, 24};
+
+sf::Font FontLoader::load() {
+    // The array is static, so it outlives the font as SFML requires for memory fonts
+    return sf::Font(ROBOTO_MONO_REGULAR, ROBOTO_MONO_REGULAR_SIZE);
+}
+
+void FontLoader::preloadGlyphs(const sf::Font& font) {
+    // Printable ASCII covers digits, units, labels and prompt text
+    for (unsigned int characterSize : HUD_CHARACTER_SIZES) {
+        for (char32_t codePoint = U' '; codePoint <= U'~'; ++codePoint) {
+            font.getGlyph(codePoint, characterSize, false);
+        }
+    }
+}
@@ -30,14 +30,12 @@ const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 const float PADDING = 10.0f;
 
-float InputHandler::getMass(sf::RenderWindow& window, const sf::Font& font){
-
-    float mass;
-    bool inputDone = false;
+InputHandler::InputHandler(const sf::Font& font, const sf::String& prompt, const sf::String& note,
+                           float minValue, float maxValue, float defaultValue)
+    : promptText(font, prompt), promptNoteText(font, note), userInputText(font, ""), previewText(font, ""),
+      minValue(minValue), maxValue(maxValue), defaultValue(defaultValue), value(defaultValue), inputDone(false) {
 
     // Prompt
-    sf::String promptString = "Enter the ball mass* (kg) and press Enter: ";
-    sf::Text promptText(font, promptString);
     promptText.setCharacterSize(24);
     promptText.setFillColor(sf::Color::White);
     sf::FloatRect promptTextBounds = promptText.getLocalBounds();
@@ -47,8 +45,6 @@ float InputHandler::getMass(sf::RenderWindow& window, const sf::Font& font){
     promptText.setPosition(promptTextPosition);
 
     // PromptNote
-    sf::String promptNoteString = "*Note: mass must be between 0.001 kg and 100 kg.";
-    sf::Text promptNoteText(font, promptNoteString);
     promptNoteText.setCharacterSize(14);
     promptNoteText.setFillColor(sf::Color::White);
     sf::FloatRect promptNoteTextBounds = promptNoteText.getLocalBounds();
@@ -58,150 +54,86 @@ float InputHandler::getMass(sf::RenderWindow& window, const sf::Font& font){
     promptNoteText.setPosition(promptNoteTextPosition);
 
     // UserInput
-    sf::String userInputString;
-    sf::Text userInputText(font, userInputString);
     userInputText.setCharacterSize(24);
     userInputText.setFillColor(sf::Color::White);
     userInputText.setOrigin(promptTextOrigin);
     sf::Vector2f userInputTextPosition = promptTextPosition + sf::Vector2f(promptTextBounds.size.x, 0);
     userInputText.setPosition(userInputTextPosition);
 
-    while (!inputDone && window.isOpen())
-    {
-        window.clear();
-        window.draw(promptText);
-        window.draw(promptNoteText);
-        window.draw(userInputText);
-        window.display();
-
-        while (const std::optional event = window.pollEvent())
-        {
-            if (event->is<sf::Event::Closed>() || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape))
-            {
-                window.close();
-                return 0.056; // Tennis ball mass
-            }
-
-            if (event->is<sf::Event::TextEntered>())
-            {
-                const auto* textEntered = event->getIf<sf::Event::TextEntered>();
-                if (textEntered)
-                {
-                    char32_t unicode = textEntered->unicode;
-                    if (unicode == 8 && !userInputString.isEmpty()) {
-                        userInputString.erase(userInputString.getSize() - 1);
-                    }
-                    else if (unicode == '\r' || unicode == '\n') {
-                        if (!userInputString.isEmpty()) {
-                            try {
-                                mass = std::stof(userInputString.toAnsiString());
-                                if (mass >= 0.001f && mass <= 100.0f)
-                                    inputDone = true;
-                            } catch (...) {
-                            }
-                        }
-                    }
-                    else if ((unicode >= '0' && unicode <= '9') || unicode == '.') {
-                        userInputString += unicode;
-                    }
-                    userInputText.setString(userInputString);
-                }
-            }
-        }
-    }
+    // Preview, left aligned under the prompt
+    previewText.setCharacterSize(20);
+    previewText.setFillColor(sf::Color::Green);
+    sf::Vector2f previewTextPosition = promptTextPosition + sf::Vector2f(-promptTextBounds.size.x/2, promptTextBounds.size.y + PADDING*2);
+    previewText.setPosition(previewTextPosition);
+}
 
-    if (!inputDone) {
-        mass = 0.056f;
-        std::cerr << "Invalid or incomplete input, using default mass (0.056 kg - tennis ball)\n";
-    }    
+InputHandler InputHandler::forMass(const sf::Font& font) {
+    return InputHandler(font, "Enter the ball mass* (kg) and press Enter: ",
+                        "*Note: mass must be between 0.001 kg and 100 kg.",
+                        0.001f, 100.0f, 0.056f); // Tennis ball mass
+}
 
-    return mass;
+InputHandler InputHandler::forHeight(const sf::Font& font) {
+    return InputHandler(font, "Enter the drop height* (m) and press Enter: ",
+                        "*Note: height must be between 1 m and 10 m for realistic simulation.",
+                        1.0f, 10.0f, 2.0f);
 }
 
-float InputHandler::getHeight(sf::RenderWindow& window, const sf::Font& font){
+void InputHandler::handleEvent(const sf::Event& event) {
+    if (inputDone)
+        return;
 
-    float height;
-    bool inputDone = false;
+    const auto* textEntered = event.getIf<sf::Event::TextEntered>();
+    if (!textEntered)
+        return;
 
-    // Prompt
-    sf::String promptString = "Enter the drop height* (m) and press Enter: ";
-    sf::Text promptText(font, promptString);
-    promptText.setCharacterSize(24);
-    promptText.setFillColor(sf::Color::White);
-    sf::FloatRect promptTextBounds = promptText.getLocalBounds();
-    sf::Vector2f promptTextOrigin(promptTextBounds.position.x + promptTextBounds.size.x/2, promptTextBounds.position.y + promptTextBounds.size.y/2);
-    promptText.setOrigin(promptTextOrigin);
-    sf::Vector2f promptTextPosition = sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2);
-    promptText.setPosition(promptTextPosition);
+    char32_t unicode = textEntered->unicode;
+    if (unicode == 8 && !userInputString.isEmpty()) {
+        userInputString.erase(userInputString.getSize() - 1);
+    }
+    else if (unicode == '\r' || unicode == '\n') {
+        std::optional<float> candidate = getCandidate();
+        if (candidate) {
+            value = *candidate;
+            inputDone = true;
+        }
+    }
+    else if ((unicode >= '0' && unicode <= '9') || unicode == '.') {
+        userInputString += unicode;
+    }
+    userInputText.setString(userInputString);
+}
 
-    // PromptNote
-    sf::String promptNoteString = "*Note: height must be between 1 m and 10 m for realistic simulation.";
-    sf::Text promptNoteText(font, promptNoteString);
-    promptNoteText.setCharacterSize(14);
-    promptNoteText.setFillColor(sf::Color::White);
-    sf::FloatRect promptNoteTextBounds = promptNoteText.getLocalBounds();
-    sf::Vector2f promptNoteTextOrigin(promptNoteTextBounds.position.x, promptNoteTextBounds.position.y + promptNoteTextBounds.size.y);
-    promptNoteText.setOrigin(promptNoteTextOrigin);
-    sf::Vector2f promptNoteTextPosition = sf::Vector2f(PADDING, WINDOW_HEIGHT-PADDING);
-    promptNoteText.setPosition(promptNoteTextPosition);
+void InputHandler::setPreview(const std::string& preview) {
+    previewText.setString(preview);
+}
 
-    // UserInput
-    sf::String userInputString;
-    sf::Text userInputText(font, userInputString);
-    userInputText.setCharacterSize(24);
-    userInputText.setFillColor(sf::Color::White);
-    userInputText.setOrigin(promptTextOrigin);
-    sf::Vector2f userInputTextPosition = promptTextPosition + sf::Vector2f(promptTextBounds.size.x, 0);
-    userInputText.setPosition(userInputTextPosition);
+void InputHandler::draw(sf::RenderWindow& window) {
+    window.draw(promptText);
+    window.draw(promptNoteText);
+    window.draw(userInputText);
+    window.draw(previewText);
+}
 
-    while (!inputDone && window.isOpen())
-    {
-        window.clear();
-        window.draw(promptText);
-        window.draw(promptNoteText);
-        window.draw(userInputText);
-        window.display();
-
-        while (const std::optional event = window.pollEvent())
-        {
-            if (event->is<sf::Event::Closed>() || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape))
-            {
-                window.close();
-                return 2.0f;
-            }
-
-            if (event->is<sf::Event::TextEntered>())
-            {
-                const auto* textEntered = event->getIf<sf::Event::TextEntered>();
-                if (textEntered)
-                {
-                    char32_t unicode = textEntered->unicode;
-                    if (unicode == 8 && !userInputString.isEmpty()) {
-                        userInputString.erase(userInputString.getSize() - 1);
-                    }
-                    else if (unicode == '\r' || unicode == '\n') {
-                        if (!userInputString.isEmpty()) {
-                            try {
-                                height = std::stof(userInputString.toAnsiString());
-                                if (height >= 1.0f && height <= 10.0f)
-                                    inputDone = true;
-                            } catch (...) {
-                            }
-                        }
-                    }
-                    else if ((unicode >= '0' && unicode <= '9') || unicode == '.') {
-                        userInputString += unicode;
-                    }
-                    userInputText.setString(userInputString);
-                }
-            }
-        }
-    }
+bool InputHandler::isDone() const {
+    return inputDone;
+}
+
+std::optional<float> InputHandler::getCandidate() const {
+    if (userInputString.isEmpty())
+        return std::nullopt;
 
-    if (!inputDone) {
-        height = 2.0f;
-        std::cerr << "Invalid or incomplete input, using default height (2 m)\n";
-    }    
+    try {
+        float candidate = std::stof(userInputString.toAnsiString());
+        if (candidate >= minValue && candidate <= maxValue)
+            return candidate;
+    } catch (...) {
+    }
+    return std::nullopt;
+}
 
-    return height;
+float InputHandler::getValue() const {
+    if (!inputDone)
+        std::cerr << "Invalid or incomplete input, using default value (" << defaultValue << ")\n";
+    return value;
 }
@@ -27,11 +27,36 @@
 #define INPUTHANDLER_H
 
 #include <SFML/Graphics.hpp>
+#include <optional>
+#include <string>
 
+// One text prompt, fed events by the main loop instead of blocking it
 class InputHandler {
+private:
+    sf::Text promptText;
+    sf::Text promptNoteText;
+    sf::Text userInputText;
+    sf::Text previewText;
+    sf::String userInputString;
+    float minValue;
+    float maxValue;
+    float defaultValue;
+    float value;
+    bool inputDone;
+
 public:
-    static float getMass(sf::RenderWindow& window, const sf::Font& font);
-    static float getHeight(sf::RenderWindow& window, const sf::Font& font);
+    InputHandler(const sf::Font& font, const sf::String& prompt, const sf::String& note,
+                 float minValue, float maxValue, float defaultValue);
+    static InputHandler forMass(const sf::Font& font);
+    static InputHandler forHeight(const sf::Font& font);
+
+    void handleEvent(const sf::Event& event);
+    void setPreview(const std::string& preview);
+    void draw(sf::RenderWindow& window);
+    bool isDone() const;
+    // The typed value while it parses and is in range, before Enter is pressed
+    std::optional<float> getCandidate() const;
+    float getValue() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "LaneRenderer.h"
+#include <cmath>
+
+const int BALL_SEGMENTS = 16;
+const float PI = 3.14159265359f;
+
+LaneRenderer::LaneRenderer(const sf::Font& font, unsigned int characterSize)
+    : font(font), characterSize(characterSize),
+      shapeVertices(sf::PrimitiveType::Triangles),
+      lineVertices(sf::PrimitiveType::Lines),
+      glyphVertices(sf::PrimitiveType::Triangles) {}
+
+void LaneRenderer::clear() {
+    // Keeps the allocated storage, so steady frames do not allocate
+    shapeVertices.clear();
+    lineVertices.clear();
+    glyphVertices.clear();
+}
+
+void LaneRenderer::addBall(sf::Vector2f center, float radius, sf::Color color) {
+    for (int i = 0; i < BALL_SEGMENTS; ++i) {
+        float angle1 = 2.0f * PI * i / BALL_SEGMENTS;
+        float angle2 = 2.0f * PI * (i + 1) / BALL_SEGMENTS;
+        shapeVertices.append(sf::Vertex{center, color});
+        shapeVertices.append(sf::Vertex{center + sf::Vector2f(std::cos(angle1), std::sin(angle1)) * radius, color});
+        shapeVertices.append(sf::Vertex{center + sf::Vector2f(std::cos(angle2), std::sin(angle2)) * radius, color});
+    }
+}
+
+void LaneRenderer::addLine(sf::Vector2f start, sf::Vector2f end, sf::Color color) {
+    lineVertices.append(sf::Vertex{start, color});
+    lineVertices.append(sf::Vertex{end, color});
+}
+
+void LaneRenderer::addText(const std::string& text, sf::Vector2f position, sf::Color color, bool vertical) {
+    float pen = 0.0f;
+    float baseline = static_cast<float>(characterSize);
+
+    for (char character : text) {
+        const sf::Glyph& glyph = font.getGlyph(static_cast<unsigned char>(character), characterSize, false);
+
+        float left = pen + glyph.bounds.position.x;
+        float top = baseline + glyph.bounds.position.y;
+        float right = left + glyph.bounds.size.x;
+        float bottom = top + glyph.bounds.size.y;
+        pen += glyph.advance;
+
+        float u1 = static_cast<float>(glyph.textureRect.position.x);
+        float v1 = static_cast<float>(glyph.textureRect.position.y);
+        float u2 = u1 + glyph.textureRect.size.x;
+        float v2 = v1 + glyph.textureRect.size.y;
+
+        // Rotating by 90 degrees maps the text x axis onto the screen y axis
+        auto place = [&](float x, float y) {
+            return vertical ? position + sf::Vector2f(baseline * 1.25f - y, x) : position + sf::Vector2f(x, y);
+        };
+
+        sf::Vertex topLeft{place(left, top), color, sf::Vector2f(u1, v1)};
+        sf::Vertex topRight{place(right, top), color, sf::Vector2f(u2, v1)};
+        sf::Vertex bottomLeft{place(left, bottom), color, sf::Vector2f(u1, v2)};
+        sf::Vertex bottomRight{place(right, bottom), color, sf::Vector2f(u2, v2)};
+
+        glyphVertices.append(topLeft);
+        glyphVertices.append(topRight);
+        glyphVertices.append(bottomLeft);
+        glyphVertices.append(bottomLeft);
+        glyphVertices.append(topRight);
+        glyphVertices.append(bottomRight);
+    }
+}
+
+float LaneRenderer::measureText(const std::string& text) const {
+    float width = 0.0f;
+    for (char character : text)
+        width += font.getGlyph(static_cast<unsigned char>(character), characterSize, false).advance;
+    return width;
+}
+
+float LaneRenderer::getLineHeight() const {
+    return characterSize * 1.25f;
+}
+
+void LaneRenderer::draw(sf::RenderWindow& window) const {
+    window.draw(lineVertices);
+    window.draw(shapeVertices);
+    window.draw(glyphVertices, sf::RenderStates(&font.getTexture(characterSize)));
+}
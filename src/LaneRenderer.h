@@ -0,0 +1,55 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LANERENDERER_H
+#define LANERENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+
+// Collects every ball, divider and label of the comparison view and draws
+// them with one call per primitive kind. Labels are built from the font's
+// glyph atlas instead of one sf::Text per string.
+class LaneRenderer {
+private:
+    const sf::Font& font;
+    unsigned int characterSize;
+    sf::VertexArray shapeVertices;
+    sf::VertexArray lineVertices;
+    sf::VertexArray glyphVertices;
+
+public:
+    LaneRenderer(const sf::Font& font, unsigned int characterSize);
+    void clear();
+    void addBall(sf::Vector2f center, float radius, sf::Color color);
+    void addLine(sf::Vector2f start, sf::Vector2f end, sf::Color color);
+    // Vertical text runs downwards from position, for lanes narrower than the string
+    void addText(const std::string& text, sf::Vector2f position, sf::Color color, bool vertical = false);
+    float measureText(const std::string& text) const;
+    float getLineHeight() const;
+    void draw(sf::RenderWindow& window) const;
+};
+
+#endif
@@ -0,0 +1,300 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ObstacleField.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+const std::uint32_t MAX_LEAF_OBSTACLES = 4;
+const std::size_t MAX_TRAVERSAL_DEPTH = 64;
+const int PEG_SEGMENTS = 12;
+const float PI = 3.14159265359f;
+
+static float dot(sf::Vector2f a, sf::Vector2f b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+static void obstacleBounds(const Obstacle& obstacle, sf::Vector2f& min, sf::Vector2f& max) {
+    if (obstacle.type == Obstacle::Type::Segment) {
+        min = sf::Vector2f(std::min(obstacle.a.x, obstacle.b.x), std::min(obstacle.a.y, obstacle.b.y));
+        max = sf::Vector2f(std::max(obstacle.a.x, obstacle.b.x), std::max(obstacle.a.y, obstacle.b.y));
+    } else {
+        min = obstacle.a - sf::Vector2f(obstacle.radius, obstacle.radius);
+        max = obstacle.a + sf::Vector2f(obstacle.radius, obstacle.radius);
+    }
+}
+
+static sf::Vector2f obstacleCentroid(const Obstacle& obstacle) {
+    if (obstacle.type == Obstacle::Type::Segment)
+        return (obstacle.a + obstacle.b) * 0.5f;
+    return obstacle.a;
+}
+
+// Earliest t in [0, maxTime) where the moving point from + delta * t reaches distance
+// `reach` from center. Starting inside while moving inwards counts as a hit at t = 0.
+static bool sweepCircle(sf::Vector2f from, sf::Vector2f delta, sf::Vector2f center, float reach,
+                        float maxTime, float& hitTime, sf::Vector2f& hitNormal) {
+    sf::Vector2f offset = from - center;
+    float b = dot(offset, delta);
+    if (b >= 0.0f)
+        return false; // Moving away or sideways
+
+    float c = dot(offset, offset) - reach * reach;
+    float t = 0.0f;
+    if (c > 0.0f) {
+        float a = dot(delta, delta);
+        float discriminant = b * b - a * c;
+        if (discriminant < 0.0f)
+            return false;
+        t = (-b - std::sqrt(discriminant)) / a;
+    }
+    if (t >= maxTime)
+        return false;
+
+    sf::Vector2f normal = from + delta * t - center;
+    float length = std::sqrt(dot(normal, normal));
+    if (length <= 0.0f)
+        return false;
+
+    hitTime = t;
+    hitNormal = normal / length;
+    return true;
+}
+
+static bool sweepSegment(sf::Vector2f from, sf::Vector2f delta, const Obstacle& segment, float radius,
+                         float maxTime, float& hitTime, sf::Vector2f& hitNormal, bool& hitFlat) {
+    sf::Vector2f axis = segment.b - segment.a;
+    float axisLengthSquared = dot(axis, axis);
+    bool hit = false;
+
+    if (axisLengthSquared > 0.0f) {
+        // Flat side of the capsule, facing the ball
+        sf::Vector2f normal = sf::Vector2f(-axis.y, axis.x) / std::sqrt(axisLengthSquared);
+        float distance = dot(from - segment.a, normal);
+        if (distance < 0.0f) {
+            normal = -normal;
+            distance = -distance;
+        }
+
+        float approach = dot(delta, normal);
+        if (approach < 0.0f) {
+            float t = std::max((radius - distance) / approach, 0.0f);
+            if (t < maxTime) {
+                float along = dot(from + delta * t - segment.a, axis) / axisLengthSquared;
+                if (along >= 0.0f && along <= 1.0f) {
+                    hitTime = t;
+                    hitNormal = normal;
+                    hitFlat = true;
+                    return true;
+                }
+            }
+        }
+    }
+
+    // Rounded ends
+    float t;
+    sf::Vector2f normal;
+    if (sweepCircle(from, delta, segment.a, radius, maxTime, t, normal)) {
+        hitTime = maxTime = t;
+        hitNormal = normal;
+        hitFlat = false;
+        hit = true;
+    }
+    if (sweepCircle(from, delta, segment.b, radius, maxTime, t, normal)) {
+        hitTime = t;
+        hitNormal = normal;
+        hitFlat = false;
+        hit = true;
+    }
+    return hit;
+}
+
+// Slab test of the ray from + delta * t, t in [0, maxTime), against a box
+static bool rayHitsBox(sf::Vector2f from, sf::Vector2f delta, sf::Vector2f min, sf::Vector2f max, float maxTime) {
+    float tMin = 0.0f;
+    float tMax = maxTime;
+    const float origin[2] = {from.x, from.y};
+    const float direction[2] = {delta.x, delta.y};
+    const float low[2] = {min.x, min.y};
+    const float high[2] = {max.x, max.y};
+
+    for (int axis = 0; axis < 2; ++axis) {
+        if (std::abs(direction[axis]) < 1e-8f) {
+            if (origin[axis] < low[axis] || origin[axis] > high[axis])
+                return false;
+            continue;
+        }
+        float inverse = 1.0f / direction[axis];
+        float t1 = (low[axis] - origin[axis]) * inverse;
+        float t2 = (high[axis] - origin[axis]) * inverse;
+        if (t1 > t2)
+            std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+    return true;
+}
+
+ObstacleField::ObstacleField(std::vector<Obstacle> obstacles)
+    : obstacles(std::move(obstacles)),
+      lineVertices(sf::PrimitiveType::Lines),
+      pegVertices(sf::PrimitiveType::Triangles) {
+
+    if (!this->obstacles.empty()) {
+        // A binary tree over n leaves has fewer than 2n nodes
+        nodes.reserve(2 * this->obstacles.size());
+        nodes.push_back(Node());
+        buildNode(0, 0, static_cast<std::uint32_t>(this->obstacles.size()));
+    }
+
+    buildVertices();
+}
+
+void ObstacleField::buildNode(std::uint32_t nodeIndex, std::uint32_t begin, std::uint32_t end) {
+    sf::Vector2f min, max;
+    obstacleBounds(obstacles[begin], min, max);
+    sf::Vector2f centroidMin = obstacleCentroid(obstacles[begin]);
+    sf::Vector2f centroidMax = centroidMin;
+
+    for (std::uint32_t i = begin; i < end; ++i) {
+        sf::Vector2f obstacleMin, obstacleMax;
+        obstacleBounds(obstacles[i], obstacleMin, obstacleMax);
+        min = sf::Vector2f(std::min(min.x, obstacleMin.x), std::min(min.y, obstacleMin.y));
+        max = sf::Vector2f(std::max(max.x, obstacleMax.x), std::max(max.y, obstacleMax.y));
+
+        sf::Vector2f centroid = obstacleCentroid(obstacles[i]);
+        centroidMin = sf::Vector2f(std::min(centroidMin.x, centroid.x), std::min(centroidMin.y, centroid.y));
+        centroidMax = sf::Vector2f(std::max(centroidMax.x, centroid.x), std::max(centroidMax.y, centroid.y));
+    }
+
+    nodes[nodeIndex].min = min;
+    nodes[nodeIndex].max = max;
+
+    if (end - begin <= MAX_LEAF_OBSTACLES) {
+        nodes[nodeIndex].first = begin;
+        nodes[nodeIndex].count = end - begin;
+        return;
+    }
+
+    // Median split along the axis where the centroids spread the most
+    bool splitX = (centroidMax.x - centroidMin.x) >= (centroidMax.y - centroidMin.y);
+    std::uint32_t middle = begin + (end - begin) / 2;
+    std::nth_element(obstacles.begin() + begin, obstacles.begin() + middle, obstacles.begin() + end,
+        [splitX](const Obstacle& left, const Obstacle& right) {
+            sf::Vector2f leftCentroid = obstacleCentroid(left);
+            sf::Vector2f rightCentroid = obstacleCentroid(right);
+            return splitX ? leftCentroid.x < rightCentroid.x : leftCentroid.y < rightCentroid.y;
+        });
+
+    std::uint32_t leftChild = static_cast<std::uint32_t>(nodes.size());
+    nodes.push_back(Node());
+    nodes.push_back(Node());
+    nodes[nodeIndex].first = leftChild;
+    nodes[nodeIndex].count = 0;
+
+    buildNode(leftChild, begin, middle);
+    buildNode(leftChild + 1, middle, end);
+}
+
+void ObstacleField::buildVertices() {
+    for (const Obstacle& obstacle : obstacles) {
+        if (obstacle.type == Obstacle::Type::Segment) {
+            lineVertices.append(sf::Vertex{obstacle.a, sf::Color::White});
+            lineVertices.append(sf::Vertex{obstacle.b, sf::Color::White});
+            continue;
+        }
+
+        for (int i = 0; i < PEG_SEGMENTS; ++i) {
+            float angle1 = 2.0f * PI * i / PEG_SEGMENTS;
+            float angle2 = 2.0f * PI * (i + 1) / PEG_SEGMENTS;
+            sf::Vector2f point1 = obstacle.a + sf::Vector2f(std::cos(angle1), std::sin(angle1)) * obstacle.radius;
+            sf::Vector2f point2 = obstacle.a + sf::Vector2f(std::cos(angle2), std::sin(angle2)) * obstacle.radius;
+            pegVertices.append(sf::Vertex{obstacle.a, sf::Color::White});
+            pegVertices.append(sf::Vertex{point1, sf::Color::White});
+            pegVertices.append(sf::Vertex{point2, sf::Color::White});
+        }
+    }
+}
+
+bool ObstacleField::isEmpty() const {
+    return obstacles.empty();
+}
+
+bool ObstacleField::sweep(sf::Vector2f from, sf::Vector2f to, float radius, float& hitTime, sf::Vector2f& hitNormal,
+                          bool& hitFlat) const {
+    if (nodes.empty())
+        return false;
+
+    sf::Vector2f delta = to - from;
+    sf::Vector2f padding(radius, radius);
+    float bestTime = 1.0f;
+    bool hit = false;
+
+    std::array<std::uint32_t, MAX_TRAVERSAL_DEPTH> stack;
+    std::size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        if (!rayHitsBox(from, delta, node.min - padding, node.max + padding, bestTime))
+            continue;
+
+        if (node.count == 0) {
+            stack[stackSize++] = node.first;
+            stack[stackSize++] = node.first + 1;
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const Obstacle& obstacle = obstacles[i];
+            float t;
+            sf::Vector2f normal;
+            bool flat = false;
+            bool obstacleHit = obstacle.type == Obstacle::Type::Segment
+                ? sweepSegment(from, delta, obstacle, radius, bestTime, t, normal, flat)
+                : sweepCircle(from, delta, obstacle.a, obstacle.radius + radius, bestTime, t, normal);
+            if (obstacleHit) {
+                bestTime = t;
+                hitNormal = normal;
+                hitFlat = flat;
+                hit = true;
+            }
+        }
+    }
+
+    if (hit)
+        hitTime = bestTime;
+    return hit;
+}
+
+void ObstacleField::draw(sf::RenderWindow& window) const {
+    if (lineVertices.getVertexCount() > 0)
+        window.draw(lineVertices);
+    if (pegVertices.getVertexCount() > 0)
+        window.draw(pegVertices);
+}
@@ -0,0 +1,65 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef OBSTACLEFIELD_H
+#define OBSTACLEFIELD_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "SceneLoader.h"
+
+// Static scene geometry behind a bounding volume hierarchy.
+// The tree is built once and stored as a flat array: inner nodes point at
+// two adjacent children, leaves at a run of obstacles.
+class ObstacleField {
+private:
+    struct Node {
+        sf::Vector2f min;
+        sf::Vector2f max;
+        std::uint32_t first; // Left child for inner nodes, first obstacle for leaves
+        std::uint32_t count; // 0 for inner nodes
+    };
+
+    std::vector<Obstacle> obstacles;
+    std::vector<Node> nodes;
+    sf::VertexArray lineVertices;
+    sf::VertexArray pegVertices;
+
+    void buildNode(std::uint32_t nodeIndex, std::uint32_t begin, std::uint32_t end);
+    void buildVertices();
+
+public:
+    explicit ObstacleField(std::vector<Obstacle> obstacles = {});
+    bool isEmpty() const;
+    // Sweeps a circle of the given radius from `from` to `to`. On a hit, returns the
+    // earliest time of impact in [0, 1], the surface normal facing the ball and
+    // whether it struck the flat side of a segment rather than a rounded end or peg.
+    bool sweep(sf::Vector2f from, sf::Vector2f to, float radius, float& hitTime, sf::Vector2f& hitNormal,
+               bool& hitFlat) const;
+    void draw(sf::RenderWindow& window) const;
+};
+
+#endif
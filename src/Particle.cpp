@@ -28,13 +28,11 @@
 
 const float PIXELS_PER_M = 57.78f;
 const float AIR_DENSITY = 1.225f;
-const float AIR_VISCOSITY = 1.81e-5f;
-const float PI = 3.14159265359f;
-const float BALL_RADIUS = 0.04f; // 4cm fixed size
 const float DRAG_MULTIPLIER = 8.0f; // Increase to exaggerate drag effect
 
 Particle::Particle(float x, float y, float mass)
-    : position(x, y), velocity(0, 0), acceleration(0, 0), mass(mass) {}
+    : position(x, y), velocity(0, 0), acceleration(0, 0), mass(mass), atRest(false),
+      type(BallCatalogue::classify(mass)) {}
 
 void Particle::applyForce(const sf::Vector2f& force) {
     acceleration += force / mass;
@@ -46,21 +44,23 @@ void Particle::update(float dt) {
     acceleration = sf::Vector2f(0, 0);
 }
 
-float Particle::calculateCrossSection() const {
-    return PI * BALL_RADIUS * BALL_RADIUS;
+float Particle::calculateCrossSection(const BallType& ballType) const {
+    return ballType.crossSection;
 }
 
-float Particle::calculateReynoldsNumber(float speed) const {
-    float diameter = 2.0f * BALL_RADIUS;
-    return (AIR_DENSITY * speed * diameter) / AIR_VISCOSITY;
+float Particle::calculateReynoldsNumber(float speed, const BallType& ballType) const {
+    return speed * ballType.reynoldsFactor;
 }
 
-float Particle::calculateDragCoefficient() const {
-    float speedPixels = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-    if (speedPixels < 0.01f) return 0.47f;
+float Particle::calculateDragCoefficient(float relativeSpeed, float densityRatio, const BallType& ballType, bool simplified) const {
+    if (ballType.dragCoefficient > 0.0f) return ballType.dragCoefficient;
+    if (simplified) return 0.47f;
 
-    float speedMeters = speedPixels / PIXELS_PER_M;
-    float reynolds = calculateReynoldsNumber(speedMeters);
+    if (relativeSpeed < 0.01f) return 0.47f;
+
+    // The catalogue's Reynolds factor assumes sea-level air
+    float speedMeters = relativeSpeed / PIXELS_PER_M;
+    float reynolds = calculateReynoldsNumber(speedMeters, ballType) * densityRatio;
 
     if (reynolds < 0.1f)
         return 24.0f / std::max(reynolds, 0.001f);
@@ -72,16 +72,17 @@ float Particle::calculateDragCoefficient() const {
         return 0.1f;
 }
 
-void Particle::applyDrag(float deltaTime) {
-    float speedPixels = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
+void Particle::applyDrag(float deltaTime, const BallType& ballType, bool simplified, const AirSample& air) {
+    sf::Vector2f relativeVelocity = velocity - air.velocity;
+    float speedPixels = std::sqrt(relativeVelocity.x * relativeVelocity.x + relativeVelocity.y * relativeVelocity.y);
     if (speedPixels < 0.01f) return;
 
     float speedMeters = speedPixels / PIXELS_PER_M;
-    float Cd = calculateDragCoefficient();
-    float A = calculateCrossSection();
+    float Cd = calculateDragCoefficient(speedPixels, air.density / AIR_DENSITY, ballType, simplified);
+    float A = calculateCrossSection(ballType);
     
-    float drag = 0.5f * AIR_DENSITY * speedMeters * speedMeters * Cd * A * DRAG_MULTIPLIER;
-    sf::Vector2f dragForce = -drag * (velocity / speedPixels) * PIXELS_PER_M;
+    float drag = 0.5f * air.density * speedMeters * speedMeters * Cd * A * DRAG_MULTIPLIER;
+    sf::Vector2f dragForce = -drag * (relativeVelocity / speedPixels) * PIXELS_PER_M;
 
     applyForce(dragForce);
 }
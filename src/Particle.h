@@ -26,6 +26,14 @@
 #ifndef PARTICLE_H
 #define PARTICLE_H
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include "BallType.h"
+
+// Air around a particle: velocity in pixels per second, density in kg/m^3
+struct AirSample {
+    sf::Vector2f velocity = sf::Vector2f(0.f, 0.f);
+    float density = 1.225f;
+};
 
 class Particle {
 public:
@@ -33,12 +41,16 @@ public:
     sf::Vector2f velocity;
     sf::Vector2f acceleration;
     float mass;
+    bool atRest;
+    std::uint8_t type; // Index into BallCatalogue::getTypes()
     Particle(float x, float y, float mass);
     void applyForce(const sf::Vector2f& force);
     void update(float dt);
-    void applyDrag(float deltaTime);
-    float calculateDragCoefficient() const;
-    float calculateCrossSection() const;
-    float calculateReynoldsNumber(float speed) const;
+    // Drag from the velocity relative to the air.
+    // The simplified model skips the Reynolds number and uses a fixed sphere Cd.
+    void applyDrag(float deltaTime, const BallType& ballType, bool simplified, const AirSample& air = AirSample());
+    float calculateDragCoefficient(float relativeSpeed, float densityRatio, const BallType& ballType, bool simplified) const;
+    float calculateCrossSection(const BallType& ballType) const;
+    float calculateReynoldsNumber(float speed, const BallType& ballType) const;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "QualityGovernor.h"
+#include <sstream>
+
+// Best quality first, each rung changes a single knob
+const QualitySettings QUALITY_LADDER[] = {
+    {4, false, 1, false},
+    {2, false, 1, false},
+    {1, false, 1, false},
+    {1, false, 4, false},
+    {1, true,  4, false},
+    {1, true,  4, true},
+};
+const int QUALITY_LEVELS = sizeof(QUALITY_LADDER) / sizeof(QUALITY_LADDER[0]);
+
+const float SMOOTHING = 0.1f;           // Weight of the newest frame in the moving average
+const float UPGRADE_HEADROOM = 0.6f;    // Upgrade only when well under budget
+const int DEGRADE_DELAY = 10;           // Frames over budget before degrading
+const int UPGRADE_DELAY = 60;           // Frames under the upgrade threshold before upgrading
+const int CHANGE_COOLDOWN = 30;         // Frames to let a change settle before judging again
+
+QualityGovernor::QualityGovernor(float frameBudgetMs, bool allowAggregateRendering)
+    : frameBudget(frameBudgetMs / 1000.0f), smoothedCost(0.0f), level(0),
+      maxLevel(allowAggregateRendering ? QUALITY_LEVELS - 1 : QUALITY_LEVELS - 2),
+      framesOverBudget(0), framesUnderBudget(0), cooldown(0) {}
+
+const QualitySettings& QualityGovernor::getSettings() const {
+    return QUALITY_LADDER[level];
+}
+
+std::string QualityGovernor::update(float physicsSeconds, float renderSeconds) {
+    float cost = physicsSeconds + renderSeconds;
+    smoothedCost = smoothedCost == 0.0f ? cost : smoothedCost + SMOOTHING * (cost - smoothedCost);
+
+    if (cooldown > 0) {
+        --cooldown;
+        return "";
+    }
+
+    framesOverBudget = smoothedCost > frameBudget ? framesOverBudget + 1 : 0;
+    framesUnderBudget = smoothedCost < frameBudget * UPGRADE_HEADROOM ? framesUnderBudget + 1 : 0;
+
+    int newLevel = level;
+    if (framesOverBudget >= DEGRADE_DELAY && level < maxLevel)
+        newLevel = level + 1;
+    else if (framesUnderBudget >= UPGRADE_DELAY && level > 0)
+        newLevel = level - 1;
+
+    if (newLevel == level)
+        return "";
+
+    std::string change = describeChange(QUALITY_LADDER[level], QUALITY_LADDER[newLevel]);
+    level = newLevel;
+    framesOverBudget = 0;
+    framesUnderBudget = 0;
+    cooldown = CHANGE_COOLDOWN;
+    return change;
+}
+
+std::string QualityGovernor::describeChange(const QualitySettings& from, const QualitySettings& to) {
+    std::ostringstream ss;
+    ss << "Quality: ";
+    if (from.substeps != to.substeps)
+        ss << "physics substeps " << from.substeps << " -> " << to.substeps;
+    else if (from.hudInterval != to.hudInterval)
+        ss << "HUD refresh every " << from.hudInterval << " -> " << to.hudInterval << " frames";
+    else if (from.simplifiedDrag != to.simplifiedDrag)
+        ss << "drag model " << (from.simplifiedDrag ? "simplified" : "full") << " -> " << (to.simplifiedDrag ? "simplified" : "full");
+    else
+        ss << "rendering " << (from.aggregateRendering ? "heatmap" : "per ball") << " -> " << (to.aggregateRendering ? "heatmap" : "per ball");
+    return ss.str();
+}
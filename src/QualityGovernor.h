@@ -0,0 +1,60 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include <string>
+
+struct QualitySettings {
+    int substeps;            // Physics steps per frame
+    bool simplifiedDrag;     // Fixed Cd instead of the Reynolds number model
+    int hudInterval;         // Frames between HUD readout refreshes
+    bool aggregateRendering; // Density heatmap instead of one shape per ball
+};
+
+// Holds the frame time under a budget by walking a ladder of quality levels,
+// one knob per rung. Frame cost is smoothed, and degrading and upgrading use
+// different thresholds and delays, so the level does not oscillate.
+class QualityGovernor {
+private:
+    float frameBudget;
+    float smoothedCost;
+    int level;
+    int maxLevel;
+    int framesOverBudget;
+    int framesUnderBudget;
+    int cooldown;
+
+    static std::string describeChange(const QualitySettings& from, const QualitySettings& to);
+
+public:
+    QualityGovernor(float frameBudgetMs, bool allowAggregateRendering);
+    // Feeds one frame's cost. Returns a description of the knob that changed, or "" if none did.
+    std::string update(float physicsSeconds, float renderSeconds);
+    const QualitySettings& getSettings() const;
+};
+
+#endif
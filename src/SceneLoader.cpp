@@ -0,0 +1,265 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "SceneLoader.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+const int WINDOW_HEIGHT = 720;
+const float PIXELS_PER_M = 57.78f;
+const float AIR_DENSITY = 1.225f;
+const std::size_t MAX_WIND_GRID_CELLS = 4096 * 4096;
+
+// Scene y = 0 is the floor itself, the bottom edge of the window
+static sf::Vector2f toPixels(float x, float y) {
+    return sf::Vector2f(x * PIXELS_PER_M, WINDOW_HEIGHT - y * PIXELS_PER_M);
+}
+
+static void addGaltonBoard(std::vector<Obstacle>& obstacles, float centerX, float topY, int rows, float spacing, float pegRadius) {
+    // Row i holds i + 1 pegs, rows are packed as equilateral triangles
+    float rowHeight = spacing * std::sqrt(3.0f) / 2.0f;
+    for (int row = 0; row < rows; ++row) {
+        float y = topY - row * rowHeight;
+        for (int column = 0; column <= row; ++column) {
+            float x = centerX + (column - row / 2.0f) * spacing;
+            obstacles.push_back({Obstacle::Type::Circle, toPixels(x, y), sf::Vector2f(), pegRadius * PIXELS_PER_M});
+        }
+    }
+}
+
+static void addPegLattice(std::vector<Obstacle>& obstacles, float centerX, float topY, int rows, int columns, float spacing, float pegRadius) {
+    // Full-width staggered rows: even rows hold columns pegs, odd rows one fewer shifted by half a spacing
+    float rowHeight = spacing * std::sqrt(3.0f) / 2.0f;
+    for (int row = 0; row < rows; ++row) {
+        float y = topY - row * rowHeight;
+        int count = row % 2 == 0 ? columns : columns - 1;
+        for (int column = 0; column < count; ++column) {
+            float x = centerX + (column - (count - 1) / 2.0f) * spacing;
+            obstacles.push_back({Obstacle::Type::Circle, toPixels(x, y), sf::Vector2f(), pegRadius * PIXELS_PER_M});
+        }
+    }
+}
+
+static Body makeChain(float x1, float y1, float x2, float y2, int links, float mass) {
+    Body body;
+    body.mass = mass;
+    for (int i = 0; i <= links; ++i) {
+        float t = static_cast<float>(i) / links;
+        body.points.push_back(toPixels(x1 + (x2 - x1) * t, y1 + (y2 - y1) * t));
+        if (i > 0)
+            body.links.emplace_back(i - 1, i);
+    }
+    return body;
+}
+
+static Body makeCloth(float x, float y, int columns, int rows, float spacing, float mass) {
+    // Structural links along rows and columns, shear links across each cell
+    Body body;
+    body.mass = mass;
+    auto index = [columns](int column, int row) { return static_cast<std::uint32_t>(row * columns + column); };
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            body.points.push_back(toPixels(x + column * spacing, y - row * spacing));
+            if (column > 0)
+                body.links.emplace_back(index(column - 1, row), index(column, row));
+            if (row > 0)
+                body.links.emplace_back(index(column, row - 1), index(column, row));
+            if (column > 0 && row > 0) {
+                body.links.emplace_back(index(column - 1, row - 1), index(column, row));
+                body.links.emplace_back(index(column, row - 1), index(column - 1, row));
+            }
+        }
+    }
+    return body;
+}
+
+static bool loadWindGrid(WindConfig& wind, const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not open wind grid " << path << "\n";
+        return false;
+    }
+
+    // Read signed and check each side before multiplying, so negative sizes cannot wrap
+    long long signedColumns, signedRows;
+    if (!(file >> signedColumns >> signedRows) || signedColumns <= 0 || signedRows <= 0
+        || static_cast<unsigned long long>(signedColumns) > MAX_WIND_GRID_CELLS
+        || static_cast<unsigned long long>(signedRows) > MAX_WIND_GRID_CELLS / static_cast<unsigned long long>(signedColumns)) {
+        std::cerr << path << ": invalid wind grid size\n";
+        return false;
+    }
+    std::size_t columns = static_cast<std::size_t>(signedColumns);
+    std::size_t rows = static_cast<std::size_t>(signedRows);
+
+    std::vector<sf::Vector2f> velocity(columns * rows);
+    std::vector<float> density(columns * rows, AIR_DENSITY);
+    std::string line;
+    std::getline(file, line);
+    for (std::size_t i = 0; i < columns * rows; ++i) {
+        float vx, vy, cellDensity;
+        if (!std::getline(file, line)) {
+            std::cerr << path << ": expected " << columns * rows << " cells, found " << i << "\n";
+            return false;
+        }
+        std::istringstream stream(line);
+        if (!(stream >> vx >> vy)) {
+            std::cerr << path << ": invalid cell \"" << line << "\"\n";
+            return false;
+        }
+        velocity[i] = sf::Vector2f(vx * PIXELS_PER_M, -vy * PIXELS_PER_M);
+        if (stream >> cellDensity && cellDensity > 0.0f)
+            density[i] = cellDensity;
+    }
+
+    wind.columns = columns;
+    wind.rows = rows;
+    wind.gridVelocity = std::move(velocity);
+    wind.gridDensity = std::move(density);
+    return true;
+}
+
+Scene SceneLoader::load(const std::string& path) {
+    Scene scene;
+    std::vector<Obstacle>& obstacles = scene.obstacles;
+
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not open scene file " << path << ", using an empty scene\n";
+        return scene;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        std::istringstream stream(line);
+        std::string kind;
+        if (!(stream >> kind) || kind[0] == '#')
+            continue;
+
+        bool valid = false;
+        if (kind == "segment") {
+            float x1, y1, x2, y2;
+            if (stream >> x1 >> y1 >> x2 >> y2) {
+                obstacles.push_back({Obstacle::Type::Segment, toPixels(x1, y1), toPixels(x2, y2), 0.0f});
+                valid = true;
+            }
+        } else if (kind == "circle") {
+            float x, y, radius;
+            if (stream >> x >> y >> radius && radius > 0.0f) {
+                obstacles.push_back({Obstacle::Type::Circle, toPixels(x, y), sf::Vector2f(), radius * PIXELS_PER_M});
+                valid = true;
+            }
+        } else if (kind == "galton") {
+            float centerX, topY, spacing, pegRadius;
+            int rows;
+            if (stream >> centerX >> topY >> rows >> spacing >> pegRadius && rows > 0 && pegRadius > 0.0f) {
+                addGaltonBoard(obstacles, centerX, topY, rows, spacing, pegRadius);
+                valid = true;
+            }
+        } else if (kind == "pegs") {
+            float centerX, topY, spacing, pegRadius;
+            int rows, columns;
+            if (stream >> centerX >> topY >> rows >> columns >> spacing >> pegRadius && rows > 0 && columns > 1 && pegRadius > 0.0f) {
+                addPegLattice(obstacles, centerX, topY, rows, columns, spacing, pegRadius);
+                valid = true;
+            }
+        } else if (kind == "balls") {
+            // Read signed, an unsigned read would wrap a negative count
+            float mass;
+            long long count;
+            if (stream >> mass >> count && mass > 0.0f && count > 0) {
+                scene.ballGroups.push_back({mass, static_cast<std::size_t>(count)});
+                valid = true;
+            }
+        } else if (kind == "release") {
+            // Balls start inside the rectangle, e.g. above the spout of a funnel
+            float x1, y1, x2, y2, mass;
+            long long count;
+            if (stream >> x1 >> y1 >> x2 >> y2 >> count >> mass && count > 0 && mass > 0.0f) {
+                sf::Vector2f corner1 = toPixels(x1, y1);
+                sf::Vector2f corner2 = toPixels(x2, y2);
+                BallGroup group{mass, static_cast<std::size_t>(count)};
+                group.hasRegion = true;
+                group.regionMin = sf::Vector2f(std::min(corner1.x, corner2.x), std::min(corner1.y, corner2.y));
+                group.regionMax = sf::Vector2f(std::max(corner1.x, corner2.x), std::max(corner1.y, corner2.y));
+                scene.ballGroups.push_back(group);
+                valid = true;
+            }
+        } else if (kind == "lane") {
+            float mass, height;
+            if (stream >> mass >> height && mass > 0.0f && height > 0.0f) {
+                scene.lanes.push_back({mass, height});
+                valid = true;
+            }
+        } else if (kind == "chain") {
+            float x1, y1, x2, y2, mass;
+            int links;
+            if (stream >> x1 >> y1 >> x2 >> y2 >> links >> mass && links > 0 && mass > 0.0f) {
+                scene.bodies.push_back(makeChain(x1, y1, x2, y2, links, mass));
+                valid = true;
+            }
+        } else if (kind == "cloth") {
+            float x, y, spacing, mass;
+            int columns, rows;
+            if (stream >> x >> y >> columns >> rows >> spacing >> mass && columns > 0 && rows > 0 && spacing > 0.0f && mass > 0.0f) {
+                scene.bodies.push_back(makeCloth(x, y, columns, rows, spacing, mass));
+                valid = true;
+            }
+        } else if (kind == "wind") {
+            float vx, vy;
+            if (stream >> vx >> vy) {
+                scene.wind.velocity = sf::Vector2f(vx * PIXELS_PER_M, -vy * PIXELS_PER_M);
+                float gust, period;
+                if (stream >> gust >> period && period > 0.0f) {
+                    scene.wind.gust = gust;
+                    scene.wind.gustPeriod = period;
+                }
+                valid = true;
+            }
+        } else if (kind == "updraft") {
+            float x, width, speed;
+            if (stream >> x >> width >> speed && width > 0.0f) {
+                scene.wind.updrafts.push_back({x * PIXELS_PER_M, width * PIXELS_PER_M, speed * PIXELS_PER_M});
+                valid = true;
+            }
+        } else if (kind == "windgrid") {
+            std::string gridPath;
+            if (stream >> gridPath) {
+                std::filesystem::path resolved = std::filesystem::path(path).parent_path() / gridPath;
+                valid = loadWindGrid(scene.wind, resolved.string());
+            }
+        }
+
+        if (!valid)
+            std::cerr << path << ":" << lineNumber << ": ignoring invalid line \"" << line << "\"\n";
+    }
+
+    return scene;
+}
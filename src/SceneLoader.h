@@ -0,0 +1,118 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SCENELOADER_H
+#define SCENELOADER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Static collider, in pixels. Segments use a and b, circles (pegs) use a and radius.
+struct Obstacle {
+    enum class Type { Segment, Circle };
+    Type type;
+    sf::Vector2f a;
+    sf::Vector2f b;
+    float radius;
+};
+
+// Extra balls of one mass, spread between the drop height and the floor,
+// or inside a release region in pixels when hasRegion is set
+struct BallGroup {
+    float mass;
+    std::size_t count;
+    bool hasRegion = false;
+    sf::Vector2f regionMin = sf::Vector2f(0.f, 0.f);
+    sf::Vector2f regionMax = sf::Vector2f(0.f, 0.f);
+};
+
+// One independent drop of the comparison mode
+struct LaneConfig {
+    float mass;
+    float height;
+};
+
+// Balls joined by distance constraints (chain, rope or soft body).
+// Links index into points.
+struct Body {
+    std::vector<sf::Vector2f> points;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> links;
+    float mass;
+};
+
+// Column of rising air spanning the whole height, in pixels
+struct Updraft {
+    float x;
+    float width;  // Distance over which the speed falls to 1/e of its peak
+    float speed;  // Peak upward speed, in pixels per second
+};
+
+// Moving air, in pixels per second. A scene without wind lines keeps still air.
+struct WindConfig {
+    sf::Vector2f velocity = sf::Vector2f(0.f, 0.f); // Uniform wind
+    float gust = 0.0f;        // Fraction by which the uniform wind swings
+    float gustPeriod = 0.0f;  // Seconds per gust cycle
+    std::vector<Updraft> updrafts;
+    std::size_t columns = 0;  // Grid from a file, stretched over the window, 0 when there is none
+    std::size_t rows = 0;
+    std::vector<sf::Vector2f> gridVelocity; // Row-major from the top left
+    std::vector<float> gridDensity;         // kg/m^3
+};
+
+struct Scene {
+    std::vector<Obstacle> obstacles;
+    std::vector<BallGroup> ballGroups;
+    std::vector<LaneConfig> lanes;
+    std::vector<Body> bodies;
+    WindConfig wind;
+};
+
+// Reads scene files, one obstacle per line, in meters measured from the left end of the floor:
+//   segment x1 y1 x2 y2
+//   circle x y radius
+//   galton centerX topY rows spacing pegRadius
+//   pegs centerX topY rows columns spacing pegRadius
+//   balls mass count
+//   release x1 y1 x2 y2 count mass
+//   lane mass height
+//   chain x1 y1 x2 y2 links mass
+//   cloth x y columns rows spacing mass
+//   wind vx vy [gust period]
+//   updraft x width speed
+//   windgrid path
+// Wind grid files, relative to the scene file, start with "columns rows" followed by
+// one "vx vy [density]" line per cell, row by row from the top left, in m/s and kg/m^3.
+// Any lane line switches the program to the side-by-side comparison mode.
+// Blank lines and lines starting with # are ignored.
+class SceneLoader {
+public:
+    static Scene load(const std::string& path);
+};
+
+#endif
@@ -24,58 +24,567 @@
  */
 
 #include "Simulation.h"
-#include "InputHandler.h"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <iostream>
 
 const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 const float PIXELS_PER_M = 57.78f;
 const float GRAVITY = 9.81f * PIXELS_PER_M;
 const int PARTICLE_SIZE = 12;
-int PARTICLE_PIXELS_HEIGHT = WINDOW_HEIGHT / 2;
-const float BASE_Y = WINDOW_HEIGHT - PARTICLE_SIZE;
+float PARTICLE_PIXELS_HEIGHT = WINDOW_HEIGHT / 2;
+const float MIN_DRAW_RADIUS = 4.0f; // Smaller balls are drawn this size so crowds stay readable
+const std::size_t LOD_PARTICLE_THRESHOLD = 10000; // Above this, balls are drawn as a density heatmap
+const unsigned int PLACEMENT_SEED = 1234; // Fixed, so a reset replays the same scene
+const int MAX_SWEEP_ITERATIONS = 4;
+const float CONTACT_SKIN = 0.01f; // Gap left between a ball and the surface it hit
+const float REST_NORMAL_Y = -0.95f; // Steepest surface a ball can settle on, about 18 degrees
+const int SOLVER_ITERATIONS = 8;
+const std::size_t TRAIL_LENGTH = 32; // Points per trail
+const std::size_t TRAIL_POINT_BUDGET = 1 << 21; // Total trail points across all balls
+const int TRAIL_SAMPLE_INTERVAL = 2; // Frames between trail points
+const float WAKE_DISTANCE = 0.1f; // Resting balls pulled further than this by a link start moving again
+const std::size_t WIND_BATCH_SIZE = 256; // Balls sampled from the wind field before they are integrated
+const int WIND_SORT_INTERVAL = 30; // Frames between sorts of the balls by wind tile
+const float STEP_RATE_PER_SUBSTEP = 60.0f; // Fixed physics steps per second for each governor substep
+const float MAX_FRAME_TIME = 0.1f; // Longer frames slow the simulation down instead of piling up steps
+const float PREVIEW_HEIGHT = 2.0f; // Drop height assumed for the prediction while the mass is typed
 
-Simulation::Simulation(sf::RenderWindow& window, const sf::Font& font)
+Simulation::Simulation(sf::RenderWindow& window, const sf::Font& font, std::size_t ballCount,
+                       Scene scene, float frameBudgetMs)
     : window(window), font(font), uiManager(font),
-      simulationFinished(false), gameStarted(false), isPaused(false), timeString(""),
-      finishedTimeString(""), particle(0, 0, 1.0f),
-      hasTouchedGround(false), timeToFirstContact(0.0f) {
-
-    float mass = InputHandler::getMass(window, font);
-    float height = InputHandler::getHeight(window, font);
-
-    PARTICLE_PIXELS_HEIGHT = BASE_Y - (height * PIXELS_PER_M);
-
-    particle = Particle(WINDOW_WIDTH / 2, PARTICLE_PIXELS_HEIGHT, mass);
+      simulationFinished(false), gameStarted(false), isPaused(false),
+      hasTouchedGround(false), timeToFirstContact(0.0f), timeString(""),
+      finishedTimeString(""), mass(1.0f), ballCount(std::max<std::size_t>(ballCount, 1)),
+      ballGroups(std::move(scene.ballGroups)), bodies(std::move(scene.bodies)),
+      workerRestCounts(threadPool.getWorkerCount(), 0), workerWakeCounts(threadPool.getWorkerCount(), 0),
+      linkVertices(sf::PrimitiveType::Lines), aggregateForced(false),
+      qualityGovernor(frameBudgetMs, false), trailsEnabled(false), obstacleField(std::move(scene.obstacles)),
+      windField(scene.wind), workerAirSamples(threadPool.getWorkerCount() * WIND_BATCH_SIZE), framesSinceWindSort(0), stepAccumulator(0.0f), simulatedTime(0.0f),
+      frameBudgetMs(frameBudgetMs), massInput(InputHandler::forMass(font)), heightInput(InputHandler::forHeight(font)),
+      inputFinished(false), height(2.0f), predictionPending(false), predictedSampleInterval(1.0f) {
 
     particleShape = sf::CircleShape(PARTICLE_SIZE);
     particleShape.setFillColor(sf::Color::Red);
     sf::Vector2f particleOrigin(PARTICLE_SIZE, PARTICLE_SIZE);
     particleShape.setOrigin(particleOrigin);
+
+    // Outline of where the precomputed trajectory puts the followed ball
+    ghostShape = sf::CircleShape(PARTICLE_SIZE);
+    ghostShape.setFillColor(sf::Color::Transparent);
+    ghostShape.setOutlineColor(sf::Color(255, 255, 255, 140));
+    ghostShape.setOutlineThickness(1.0f);
+    ghostShape.setOrigin(particleOrigin);
+}
+
+// Draws a ball at least minRadius, keeping the bottom of the circle where the
+// real ball touches the floor. Contact still uses the real radius.
+static void setDrawRadius(sf::CircleShape& shape, float radius, float minRadius) {
+    float drawRadius = std::max(radius, minRadius);
+    sf::Vector2f origin(drawRadius, 2.0f * drawRadius - radius);
+    if (shape.getRadius() == drawRadius && shape.getOrigin() == origin)
+        return;
+    shape.setRadius(drawRadius);
+    shape.setOrigin(origin);
+}
+
+void Simulation::configure() {
+    // Runs once both prompts are confirmed. The height is measured from the bottom of the ball.
+    const BallType& followedType = BallCatalogue::getTypes()[BallCatalogue::classify(mass)];
+    PARTICLE_PIXELS_HEIGHT = WINDOW_HEIGHT - followedType.pixelRadius - (height * PIXELS_PER_M);
+    setDrawRadius(ghostShape, followedType.pixelRadius, PARTICLE_SIZE);
+
+    placeParticles();
     particleShape.setPosition(sf::Vector2f(WINDOW_WIDTH / 2, PARTICLE_PIXELS_HEIGHT));
 
+    aggregateForced = particles.size() > LOD_PARTICLE_THRESHOLD;
+    if (aggregateForced)
+        densityRenderer.emplace(threadPool, WINDOW_WIDTH, WINDOW_HEIGHT);
+
+    // A single ball gains nothing from the heatmap, so the governor only offers it for real crowds
+    qualityGovernor = QualityGovernor(frameBudgetMs, particles.size() > 1 && !aggregateForced);
+    uiManager.setUpdateInterval(qualityGovernor.getSettings().hudInterval);
+
     uiManager.setupUI(mass, height);
+
+    // Usually finished while the height was typed, otherwise picked up by run().
+    // Requested again in case the last keystroke and Enter arrived in the same frame.
+    trajectoryPredictor.request(mass, height);
+    uiManager.setPrediction(describePrediction(mass, height));
+}
+
+void Simulation::updateInput() {
+    if (massInput.isDone())
+        mass = massInput.getValue();
+
+    if (heightInput.isDone()) {
+        height = heightInput.getValue();
+        inputFinished = true;
+        configure();
+        return;
+    }
+
+    // Speculatively drop the ball for whatever is typed so far, a new keystroke cancels the last run
+    InputHandler& input = massInput.isDone() ? heightInput : massInput;
+    std::optional<float> candidate = input.getCandidate();
+    if (candidate) {
+        float candidateMass = massInput.isDone() ? mass : *candidate;
+        float candidateHeight = massInput.isDone() ? *candidate : PREVIEW_HEIGHT;
+        trajectoryPredictor.request(candidateMass, candidateHeight);
+        std::string preview = describePrediction(candidateMass, candidateHeight);
+        if (!massInput.isDone())
+            preview += " (from 2 m)";
+        input.setPreview(preview);
+    } else {
+        trajectoryPredictor.cancel();
+        input.setPreview("");
+    }
+
+    window.clear();
+    input.draw(window);
+    window.display();
+}
+
+std::string Simulation::describePrediction(float mass, float height) {
+    std::optional<TrajectoryPrediction> prediction = trajectoryPredictor.getResult(mass, height);
+    predictionPending = !prediction;
+    if (!prediction)
+        return "Predicting...";
+
+    predictedTrajectory = std::move(prediction->trajectory);
+    predictedSampleInterval = prediction->sampleInterval;
+
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(2)
+       << "Predicted first contact: " << prediction->timeToFirstContact << " s | "
+       << "Total time: " << prediction->totalTime << " s";
+    if (!windField.isEmpty())
+        ss << " in still air";
+    return ss.str();
+}
+
+void Simulation::drawPredictedBall() {
+    // The prediction knows nothing about obstacles or wind, so it is only shown for a free drop in still air
+    if (predictedTrajectory.empty() || !obstacleField.isEmpty() || !windField.isEmpty())
+        return;
+
+    // Samples are evenly spaced in time, so the current one is found by index
+    float time = simulatedTime;
+    std::size_t index = std::min(static_cast<std::size_t>(time / predictedSampleInterval), predictedTrajectory.size() - 1);
+    float predictedHeight = predictedTrajectory[index].y;
+    if (index + 1 < predictedTrajectory.size()) {
+        const sf::Vector2f& from = predictedTrajectory[index];
+        const sf::Vector2f& to = predictedTrajectory[index + 1];
+        float blend = std::clamp((time - from.x) / (to.x - from.x), 0.0f, 1.0f);
+        predictedHeight = from.y + (to.y - from.y) * blend;
+    }
+
+    float floorY = WINDOW_HEIGHT - BallCatalogue::getTypes()[particles[0].type].pixelRadius;
+    ghostShape.setPosition(sf::Vector2f(WINDOW_WIDTH / 2, floorY - predictedHeight * PIXELS_PER_M));
+    window.draw(ghostShape);
+}
+
+void Simulation::placeParticles() {
+    std::size_t totalCount = ballCount;
+    for (const BallGroup& group : ballGroups)
+        totalCount += group.count;
+    for (const Body& body : bodies)
+        totalCount += body.points.size();
+
+    particles.clear();
+    particles.reserve(totalCount);
+    particles.emplace_back(WINDOW_WIDTH / 2, PARTICLE_PIXELS_HEIGHT, mass);
+
+    // Extra balls fill the space between the drop height and the floor,
+    // large balls are lifted so they do not start inside it
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    auto aboveFloor = [&ballTypes](Particle& particle) {
+        particle.position.y = std::min(particle.position.y, WINDOW_HEIGHT - ballTypes[particle.type].pixelRadius);
+    };
+    std::mt19937 generator(PLACEMENT_SEED);
+    std::uniform_real_distribution<float> xDistribution(PARTICLE_SIZE, WINDOW_WIDTH - PARTICLE_SIZE);
+    std::uniform_real_distribution<float> yDistribution(PARTICLE_PIXELS_HEIGHT, WINDOW_HEIGHT);
+    for (std::size_t i = 1; i < ballCount; ++i) {
+        float x = xDistribution(generator);
+        float y = yDistribution(generator);
+        particles.emplace_back(x, y, mass);
+        aboveFloor(particles.back());
+    }
+    for (const BallGroup& group : ballGroups) {
+        std::uniform_real_distribution<float> regionX(group.regionMin.x, group.regionMax.x);
+        std::uniform_real_distribution<float> regionY(group.regionMin.y, group.regionMax.y);
+        for (std::size_t i = 0; i < group.count; ++i) {
+            float x = group.hasRegion ? regionX(generator) : xDistribution(generator);
+            float y = group.hasRegion ? regionY(generator) : yDistribution(generator);
+            particles.emplace_back(x, y, group.mass);
+            aboveFloor(particles.back());
+        }
+    }
+
+    std::vector<DistanceConstraint> constraints;
+    for (const Body& body : bodies) {
+        std::uint32_t first = static_cast<std::uint32_t>(particles.size());
+        for (const sf::Vector2f& point : body.points) {
+            particles.emplace_back(point.x, point.y, body.mass);
+            aboveFloor(particles.back());
+        }
+        for (const auto& link : body.links) {
+            sf::Vector2f delta = body.points[link.second] - body.points[link.first];
+            float restLength = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+            constraints.push_back({first + link.first, first + link.second, restLength});
+        }
+    }
+
+    // Bucket by type so the step runs over spans sharing one set of constants,
+    // then by wind tile so neighbouring balls read neighbouring air.
+    // The followed ball stays at index 0, constraints follow their particles.
+    auto byType = [this](const Particle& left, const Particle& right) {
+        if (left.type != right.type)
+            return left.type < right.type;
+        return windField.getTile(left.position) < windField.getTile(right.position);
+    };
+    if (!std::is_sorted(particles.begin() + 1, particles.end(), byType)) {
+        std::vector<std::uint32_t> order(particles.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin() + 1, order.end(), [&](std::uint32_t left, std::uint32_t right) {
+            return byType(particles[left], particles[right]);
+        });
+
+        std::vector<Particle> sorted;
+        sorted.reserve(particles.size());
+        std::vector<std::uint32_t> newIndex(particles.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            sorted.push_back(particles[order[i]]);
+            newIndex[order[i]] = static_cast<std::uint32_t>(i);
+        }
+        particles.swap(sorted);
+
+        for (DistanceConstraint& constraint : constraints) {
+            constraint.a = newIndex[constraint.a];
+            constraint.b = newIndex[constraint.b];
+        }
+    }
+
+    constraintSolver.build(constraints, particles.size());
+    previousPositions.assign(constraintSolver.isEmpty() ? 0 : particles.size(), sf::Vector2f());
+
+    typeSpans.clear();
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        if (typeSpans.empty() || typeSpans.back().type != particles[i].type)
+            typeSpans.push_back({i, i, particles[i].type});
+        typeSpans.back().end = i + 1;
+    }
 }
 
 void Simulation::resetSimulation() {
-    particle.position = sf::Vector2f(WINDOW_WIDTH / 2, PARTICLE_PIXELS_HEIGHT);
-    particle.velocity = sf::Vector2f(0, 0);
+    placeParticles();
+    if (trailRenderer)
+        trailRenderer->clear();
     hasTouchedGround = false;
     timeToFirstContact = 0.0f;
-    totalClock.restart();
+    windField.reset();
+    framesSinceWindSort = 0;
+    stepAccumulator = 0.0f;
+    simulatedTime = 0.0f;
     frameClock.restart();
 }
 
+void Simulation::sortByWindTile() {
+    // Balls drift out of the tile they were placed in, so each type span is
+    // counting-sorted by tile again. Index 0 keeps the followed ball.
+    const std::size_t tileCount = windField.getTileCount();
+    for (const TypeSpan& span : typeSpans) {
+        std::size_t begin = std::max<std::size_t>(span.begin, 1);
+        if (span.end <= begin + 1)
+            continue;
+
+        tileOffsets.assign(tileCount + 1, 0);
+        for (std::size_t i = begin; i < span.end; ++i)
+            ++tileOffsets[windField.getTile(particles[i].position) + 1];
+        for (std::size_t tile = 0; tile < tileCount; ++tile)
+            tileOffsets[tile + 1] += tileOffsets[tile];
+
+        sortBuffer.resize(span.end - begin, particles[begin]);
+        for (std::size_t i = begin; i < span.end; ++i)
+            sortBuffer[tileOffsets[windField.getTile(particles[i].position)]++] = particles[i];
+        std::copy(sortBuffer.begin(), sortBuffer.begin() + (span.end - begin), particles.begin() + begin);
+    }
+}
+
+std::size_t Simulation::stepSpan(std::size_t begin, std::size_t end, const BallType& ballType, float deltaTime,
+                                 bool simplifiedDrag, std::size_t worker) {
+    // Per-type constants are read once for the whole span
+    const float cor = ballType.cor;
+    // A resting ball gains GRAVITY * deltaTime every step before it meets the floor again,
+    // so that much is allowed on top of restSpeed or large steps would bounce it forever
+    const float restThreshold = ballType.restSpeed + GRAVITY * deltaTime;
+    const float floorY = WINDOW_HEIGHT - ballType.pixelRadius;
+    const bool hasObstacles = !obstacleField.isEmpty();
+    const bool hasConstraints = !previousPositions.empty();
+    const bool hasWind = !windField.isEmpty();
+    AirSample* airSamples = hasWind ? &workerAirSamples[worker * WIND_BATCH_SIZE] : nullptr;
+    const AirSample stillAir;
+    std::size_t restCount = 0;
+
+    for (std::size_t batchBegin = begin; batchBegin < end; batchBegin += WIND_BATCH_SIZE) {
+        std::size_t batchEnd = std::min(batchBegin + WIND_BATCH_SIZE, end);
+        // The whole batch is sampled before it is integrated, so the grid reads run back to back
+        if (hasWind)
+            windField.sample(&particles[batchBegin], batchEnd - batchBegin, airSamples);
+
+        for (std::size_t i = batchBegin; i < batchEnd; ++i) {
+            Particle& particle = particles[i];
+            if (hasConstraints)
+                previousPositions[i] = particle.position;
+            if (particle.atRest) {
+                ++restCount;
+                continue;
+            }
+
+            sf::Vector2f gravityForce(0.f, GRAVITY * particle.mass);
+            particle.applyForce(gravityForce);
+            particle.applyDrag(deltaTime, ballType, simplifiedDrag, hasWind ? airSamples[i - batchBegin] : stillAir);
+            sf::Vector2f previousPosition = particle.position;
+            particle.update(deltaTime);
+
+            if (hasObstacles)
+                collideWithObstacles(particle, previousPosition, ballType, restThreshold);
+
+            if (particle.position.y > floorY) {
+                particle.position.y = floorY;
+
+                float impactSpeed = std::abs(particle.velocity.y);
+
+                if (impactSpeed > restThreshold) {
+                    particle.velocity.y = -particle.velocity.y * cor;
+                } else {
+                    particle.velocity.y = 0.f;
+                    particle.atRest = true;
+                }
+            }
+
+            if (particle.atRest)
+                ++restCount;
+        }
+    }
+
+    return restCount;
+}
+
+void Simulation::stepParticles(float deltaTime) {
+    std::fill(workerRestCounts.begin(), workerRestCounts.end(), 0);
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    const bool simplifiedDrag = qualityGovernor.getSettings().simplifiedDrag;
+    windField.advance(deltaTime);
+    simulatedTime += deltaTime;
+
+    threadPool.parallelFor(particles.size(), [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        std::size_t restCount = 0;
+
+        for (const TypeSpan& span : typeSpans) {
+            std::size_t spanBegin = std::max(begin, span.begin);
+            std::size_t spanEnd = std::min(end, span.end);
+            if (spanBegin < spanEnd)
+                restCount += stepSpan(spanBegin, spanEnd, ballTypes[span.type], deltaTime, simplifiedDrag, worker);
+        }
+
+        workerRestCounts[worker] = restCount;
+    });
+
+    std::size_t restCount = std::accumulate(workerRestCounts.begin(), workerRestCounts.end(), std::size_t(0));
+    if (!constraintSolver.isEmpty())
+        restCount -= solveConstraints(deltaTime);
+
+    const float followedFloorY = WINDOW_HEIGHT - ballTypes[particles[0].type].pixelRadius;
+    if (!hasTouchedGround && particles[0].position.y >= followedFloorY) {
+        hasTouchedGround = true;
+        timeToFirstContact = simulatedTime;
+    }
+
+    if (restCount == particles.size()) {
+        simulationFinished = true;
+
+        float totalTime = simulatedTime;
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(2)
+           << "First contact: " << timeToFirstContact << " s | "
+           << "Total time: " << totalTime << " s";
+        finishedTimeString = ss.str();
+    }
+}
+
+std::size_t Simulation::solveConstraints(float deltaTime) {
+    // Position-based dynamics: project the links on the integrated positions,
+    // then derive the velocities of linked balls from how far they actually moved
+    constraintSolver.solve(particles, SOLVER_ITERATIONS, threadPool);
+
+    const std::vector<std::uint32_t>& constrained = constraintSolver.getConstrainedParticles();
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    std::fill(workerWakeCounts.begin(), workerWakeCounts.end(), 0);
+
+    threadPool.parallelFor(constrained.size(), [&](std::size_t begin, std::size_t end, std::size_t worker) {
+        std::size_t wakeCount = 0;
+
+        for (std::size_t k = begin; k < end; ++k) {
+            std::uint32_t i = constrained[k];
+            Particle& particle = particles[i];
+            float floorY = WINDOW_HEIGHT - ballTypes[particle.type].pixelRadius;
+            if (particle.position.y > floorY)
+                particle.position.y = floorY;
+
+            sf::Vector2f moved = particle.position - previousPositions[i];
+            if (particle.atRest) {
+                if (std::abs(moved.x) <= WAKE_DISTANCE && std::abs(moved.y) <= WAKE_DISTANCE)
+                    continue;
+                particle.atRest = false;
+                ++wakeCount;
+            }
+            if (deltaTime > 0.0f)
+                particle.velocity = moved / deltaTime;
+        }
+
+        workerWakeCounts[worker] = wakeCount;
+    });
+
+    return std::accumulate(workerWakeCounts.begin(), workerWakeCounts.end(), std::size_t(0));
+}
+
+void Simulation::collideWithObstacles(Particle& particle, sf::Vector2f previousPosition, const BallType& ballType,
+                                      float restThreshold) const {
+    // Sweep the whole step so fast balls cannot tunnel through thin ramps or pegs.
+    // After each hit the rest of the motion slides along the surface and is swept again.
+    sf::Vector2f from = previousPosition;
+
+    for (int i = 0; i < MAX_SWEEP_ITERATIONS; ++i) {
+        float hitTime;
+        sf::Vector2f normal;
+        bool flat;
+        if (!obstacleField.sweep(from, particle.position, ballType.pixelRadius, hitTime, normal, flat))
+            return;
+
+        sf::Vector2f motion = particle.position - from;
+        sf::Vector2f contact = from + motion * hitTime + normal * CONTACT_SKIN;
+        sf::Vector2f remaining = motion * (1.0f - hitTime);
+        remaining -= normal * (remaining.x * normal.x + remaining.y * normal.y);
+
+        float normalSpeed = particle.velocity.x * normal.x + particle.velocity.y * normal.y;
+        if (normalSpeed < -restThreshold) {
+            particle.velocity -= normal * ((1.0f + ballType.cor) * normalSpeed);
+        } else {
+            // Only near-level flat faces can hold a ball. On slopes, pegs and rounded ends
+            // it keeps its tangential speed and gravity carries it off.
+            particle.velocity -= normal * normalSpeed;
+            float speed = std::sqrt(particle.velocity.x * particle.velocity.x + particle.velocity.y * particle.velocity.y);
+            if (speed <= restThreshold && flat && normal.y < REST_NORMAL_Y) {
+                particle.velocity = sf::Vector2f(0.f, 0.f);
+                particle.position = contact;
+                particle.atRest = true;
+                return;
+            }
+        }
+
+        from = contact;
+        particle.position = contact + remaining;
+    }
+}
+
+void Simulation::drawParticles() {
+    windField.draw(window);
+
+    // Obstacles and trails go over the heatmap, so pegs and ramps stay visible inside dense crowds
+    bool aggregate = densityRenderer && (aggregateForced || qualityGovernor.getSettings().aggregateRendering);
+    if (aggregate) {
+        densityRenderer->update(particles);
+        densityRenderer->draw(window);
+    }
+
+    obstacleField.draw(window);
+
+    if (trailsEnabled)
+        trailRenderer->draw(window, aggregate);
+
+    if (aggregate)
+        return;
+
+    if (!constraintSolver.isEmpty()) {
+        linkVertices.clear();
+        for (const DistanceConstraint& constraint : constraintSolver.getConstraints()) {
+            linkVertices.append(sf::Vertex{particles[constraint.a].position, sf::Color(160, 160, 160)});
+            linkVertices.append(sf::Vertex{particles[constraint.b].position, sf::Color(160, 160, 160)});
+        }
+        window.draw(linkVertices);
+    }
+
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    for (const TypeSpan& span : typeSpans) {
+        setDrawRadius(particleShape, ballTypes[span.type].pixelRadius, MIN_DRAW_RADIUS);
+        particleShape.setFillColor(ballTypes[span.type].color);
+        for (std::size_t i = span.begin; i < span.end; ++i) {
+            particleShape.setPosition(particles[i].position);
+            window.draw(particleShape);
+        }
+    }
+
+    // The followed ball stays red, on top and at least the classic ball size
+    setDrawRadius(particleShape, ballTypes[particles[0].type].pixelRadius, PARTICLE_SIZE);
+    particleShape.setFillColor(sf::Color::Red);
+    particleShape.setPosition(particles[0].position);
+    window.draw(particleShape);
+}
+
+void Simulation::applyQualityChange(const std::string& change) {
+    if (change.empty())
+        return;
+
+    const QualitySettings& settings = qualityGovernor.getSettings();
+    uiManager.setUpdateInterval(settings.hudInterval);
+    if (settings.aggregateRendering && !densityRenderer)
+        densityRenderer.emplace(threadPool, WINDOW_WIDTH, WINDOW_HEIGHT);
+
+    uiManager.setQualityNotice(change);
+    std::cerr << change << "\n";
+}
+
+void Simulation::toggleTrails() {
+    trailsEnabled = !trailsEnabled;
+    if (trailsEnabled && !trailRenderer)
+        trailRenderer.emplace(threadPool, particles, TRAIL_LENGTH, TRAIL_POINT_BUDGET, TRAIL_SAMPLE_INTERVAL);
+    else if (trailsEnabled)
+        trailRenderer->clear();
+}
+
 void Simulation::run() {
     while (window.isOpen()) {
         while (const std::optional event = window.pollEvent()) {
             if (event->is<sf::Event::Closed>() || sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Escape)) {
                 window.close();
             }
+
+            if (!inputFinished) {
+                InputHandler& input = massInput.isDone() ? heightInput : massInput;
+                input.handleEvent(*event);
+                continue;
+            }
+
+            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
+                if (keyPressed->code == sf::Keyboard::Key::T)
+                    toggleTrails();
+            }
+        }
+
+        if (!inputFinished) {
+            updateInput();
+            continue;
         }
 
+        if (predictionPending)
+            uiManager.setPrediction(describePrediction(mass, height));
+
         if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Enter) && !gameStarted) {
             gameStarted = true;
             resetSimulation();
@@ -90,77 +599,66 @@ void Simulation::run() {
 
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Backspace) && !simulationFinished) {
                 isPaused = true;
-                totalClock.stop();
                 frameClock.stop();
             }
 
             if (isPaused) {
                 if (isPaused) {
                 window.clear();
-                window.draw(particleShape);
-                uiManager.drawSimulationUI(window, particle);
-                uiManager.drawTime(window, particle, timeString);
+                drawParticles();
+                drawPredictedBall();
+                uiManager.drawSimulationUI(window, particles[0]);
+                uiManager.drawTime(window, particles[0], timeString);
                 uiManager.drawPauseScreen(window);
                 window.display();
                 
                 if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Enter)) {
                     isPaused = false;
-                    totalClock.start();
                     frameClock.start();
                 }
             }
             }
 
             if (!isPaused && !simulationFinished) {
+                sf::Clock costClock;
                 float deltaTime = frameClock.restart().asSeconds();
 
-                sf::Vector2f gravityForce(0.f, GRAVITY * particle.mass);
-                particle.applyForce(gravityForce);
-                particle.applyDrag(deltaTime);
-                particle.update(deltaTime);
+                // Fixed steps, so the substep setting only trades accuracy for cost
+                int substeps = qualityGovernor.getSettings().substeps;
+                float stepTime = 1.0f / (STEP_RATE_PER_SUBSTEP * substeps);
+                stepAccumulator += std::min(deltaTime, MAX_FRAME_TIME);
+                while (stepAccumulator >= stepTime && !simulationFinished) {
+                    stepParticles(stepTime);
+                    stepAccumulator -= stepTime;
+                }
+                if (trailsEnabled)
+                    trailRenderer->record(particles);
+                // Skipped while rings or links refer to balls by index
+                if (!windField.isEmpty() && windField.getTileCount() > 1 && constraintSolver.isEmpty() && !trailsEnabled
+                    && ++framesSinceWindSort >= WIND_SORT_INTERVAL) {
+                    framesSinceWindSort = 0;
+                    sortByWindTile();
+                }
+                float physicsTime = costClock.restart().asSeconds();
 
-                float time = totalClock.getElapsedTime().asSeconds();
                         std::ostringstream sst;
-                        sst << std::fixed << std::setprecision(2) << time << " s";
+                        sst << std::fixed << std::setprecision(2) << simulatedTime << " s";
                         timeString = sst.str();
 
-                if (particle.position.y > BASE_Y) {
-                    particle.position.y = BASE_Y;
-
-                    float impactSpeed = std::abs(particle.velocity.y);
-
-                    if (!hasTouchedGround) {
-                        hasTouchedGround = true;
-                        timeToFirstContact = totalClock.getElapsedTime().asSeconds();
-                    }
-
-                    if (impactSpeed > 2.0f) {
-                        float COR = 0.7f;
-                        particle.velocity.y = -particle.velocity.y * COR;
-                    } else {
-                        particle.velocity.y = 0.f;
-                        simulationFinished = true;
-
-                        float totalTime = totalClock.getElapsedTime().asSeconds();
-                        std::ostringstream ss;
-                        ss << std::fixed << std::setprecision(2)
-                           << "First contact: " << timeToFirstContact << " s | "
-                           << "Total time: " << totalTime << " s";
-                        finishedTimeString = ss.str();
-                    }
-                }
-
-                particleShape.setPosition(particle.position);
-
                 window.clear();
-                window.draw(particleShape);
-                uiManager.drawSimulationUI(window, particle);
-                uiManager.drawTime(window, particle, timeString);
+                drawParticles();
+                drawPredictedBall();
+                uiManager.drawSimulationUI(window, particles[0]);
+                uiManager.drawTime(window, particles[0], timeString);
+                uiManager.drawQualityNotice(window);
                 window.display();
+                float renderTime = costClock.getElapsedTime().asSeconds();
+
+                applyQualityChange(qualityGovernor.update(physicsTime, renderTime));
             } else if (simulationFinished) {
                 window.clear();
-                window.draw(particleShape);
-                uiManager.drawFinishedScreen(window, particle, finishedTimeString);
+                drawParticles();
+                uiManager.drawFinishedScreen(window, particles[0], finishedTimeString);
                 window.display();
             }
         } else {
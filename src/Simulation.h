@@ -27,14 +27,37 @@
 #define SIMULATION_H
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
 #include "Particle.h"
 #include "UIManager.h"
+#include "ThreadPool.h"
+#include "DensityRenderer.h"
+#include "ObstacleField.h"
+#include "SceneLoader.h"
+#include "BallType.h"
+#include "ConstraintSolver.h"
+#include "QualityGovernor.h"
+#include "TrailRenderer.h"
+#include "InputHandler.h"
+#include "TrajectoryPredictor.h"
+#include "WindField.h"
 
 class Simulation {
 private:
+    // Run of consecutive particles sharing one ball type
+    struct TypeSpan {
+        std::size_t begin;
+        std::size_t end;
+        std::uint8_t type;
+    };
+
     sf::RenderWindow& window;
     const sf::Font& font;
     UIManager uiManager;
+    ThreadPool threadPool;
     
     bool simulationFinished;
     bool gameStarted;
@@ -44,13 +67,62 @@ private:
     std::string timeString;
     std::string finishedTimeString;
     
-    Particle particle;
+    float mass;
+    std::size_t ballCount;
+    std::vector<BallGroup> ballGroups;
+    std::vector<Body> bodies;
+    std::vector<Particle> particles; // particles[0] is the ball followed by the HUD
+    std::vector<TypeSpan> typeSpans;
+    std::vector<std::size_t> workerRestCounts;
+    std::vector<std::size_t> workerWakeCounts;
+    ConstraintSolver constraintSolver;
+    std::vector<sf::Vector2f> previousPositions; // Only kept when there are constraints
+    sf::VertexArray linkVertices;
     sf::CircleShape particleShape;
-    sf::Clock totalClock;
+    std::optional<DensityRenderer> densityRenderer;
+    bool aggregateForced; // Too many balls to ever draw one by one
+    QualityGovernor qualityGovernor;
+    std::optional<TrailRenderer> trailRenderer; // Created the first time trails are turned on
+    bool trailsEnabled;
+    ObstacleField obstacleField;
+    WindField windField;
+    std::vector<AirSample> workerAirSamples; // One batch of samples per worker
+    std::vector<Particle> sortBuffer;
+    std::vector<std::size_t> tileOffsets;
+    int framesSinceWindSort;
+    float stepAccumulator; // Frame time not yet covered by a fixed physics step
+    float simulatedTime;   // Sum of the physics steps taken, which the readouts and the prediction share
+    float frameBudgetMs;
+    InputHandler massInput;
+    InputHandler heightInput;
+    bool inputFinished;
+    float height;
+    TrajectoryPredictor trajectoryPredictor;
+    bool predictionPending;
+    std::vector<sf::Vector2f> predictedTrajectory; // (time in s, height in m) of the followed ball
+    float predictedSampleInterval;
+    sf::CircleShape ghostShape;
     sf::Clock frameClock;
 
+    void configure();
+    void updateInput();
+    std::string describePrediction(float mass, float height);
+    void drawPredictedBall();
+    void placeParticles();
+    void stepParticles(float deltaTime);
+    std::size_t stepSpan(std::size_t begin, std::size_t end, const BallType& ballType, float deltaTime,
+                         bool simplifiedDrag, std::size_t worker);
+    void sortByWindTile();
+    std::size_t solveConstraints(float deltaTime);
+    void collideWithObstacles(Particle& particle, sf::Vector2f previousPosition, const BallType& ballType,
+                              float restThreshold) const;
+    void drawParticles();
+    void applyQualityChange(const std::string& change);
+    void toggleTrails();
+
 public:
-    Simulation(sf::RenderWindow& window, const sf::Font& font);
+    Simulation(sf::RenderWindow& window, const sf::Font& font, std::size_t ballCount = 1,
+               Scene scene = {}, float frameBudgetMs = 16.6f);
     void resetSimulation();
     void run();
 };
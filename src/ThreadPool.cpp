@@ -0,0 +1,107 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t workerCount)
+    : currentTask(nullptr), taskCount(0), generation(0), pendingWorkers(0), stopping(false) {
+
+    workerCount = std::max<std::size_t>(workerCount, 1);
+    for (std::size_t worker = 1; worker < workerCount; ++worker) {
+        threads.emplace_back(&ThreadPool::workerLoop, this, worker);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workReady.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+std::size_t ThreadPool::getWorkerCount() const {
+    return threads.size() + 1;
+}
+
+void ThreadPool::runChunk(const Task& task, std::size_t count, std::size_t worker) const {
+    std::size_t workerCount = getWorkerCount();
+    std::size_t begin = count * worker / workerCount;
+    std::size_t end = count * (worker + 1) / workerCount;
+    if (begin < end)
+        task(begin, end, worker);
+}
+
+void ThreadPool::parallelFor(std::size_t count, const Task& task) {
+    if (threads.empty()) {
+        runChunk(task, count, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentTask = &task;
+        taskCount = count;
+        pendingWorkers = threads.size();
+        ++generation;
+    }
+    workReady.notify_all();
+
+    runChunk(task, count, 0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this] { return pendingWorkers == 0; });
+    currentTask = nullptr;
+}
+
+void ThreadPool::workerLoop(std::size_t worker) {
+    std::size_t seenGeneration = 0;
+
+    while (true) {
+        const Task* task;
+        std::size_t count;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+            seenGeneration = generation;
+            task = currentTask;
+            count = taskCount;
+        }
+
+        runChunk(*task, count, worker);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pendingWorkers == 0)
+                workDone.notify_one();
+        }
+    }
+}
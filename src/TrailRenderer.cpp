@@ -0,0 +1,103 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TrailRenderer.h"
+#include "BallType.h"
+#include <algorithm>
+#include <cstdint>
+
+const sf::Color HEATMAP_TRAIL_COLOR(80, 200, 255);
+const sf::Color HEATMAP_FOLLOWED_COLOR(60, 255, 120);
+
+TrailRenderer::TrailRenderer(ThreadPool& threadPool, const std::vector<Particle>& particles, std::size_t capacity,
+                             std::size_t pointBudget, int sampleInterval)
+    : threadPool(threadPool), capacity(std::max<std::size_t>(capacity, 2)), head(0), length(0),
+      sampleInterval(std::max(sampleInterval, 1)), framesSinceSample(0),
+      vertices(sf::PrimitiveType::LineStrip) {
+
+    // Big scenes only trail a regular subset of balls, so memory stays within the budget
+    std::size_t maxTrails = std::max<std::size_t>(pointBudget / this->capacity, 1);
+    stride = (particles.size() + maxTrails - 1) / maxTrails;
+    stride = std::max<std::size_t>(stride, 1);
+    trailCount = (particles.size() + stride - 1) / stride;
+
+    points.assign(trailCount * this->capacity, sf::Vector2f());
+    colors.resize(trailCount);
+    const std::vector<BallType>& ballTypes = BallCatalogue::getTypes();
+    for (std::size_t trail = 0; trail < trailCount; ++trail)
+        colors[trail] = trail == 0 ? sf::Color::Red : ballTypes[particles[trail * stride].type].color;
+
+    // Two hidden vertices between trails keep the strip from joining them visibly
+    vertices.resize(trailCount * (this->capacity + 2));
+}
+
+void TrailRenderer::clear() {
+    length = 0;
+    framesSinceSample = 0;
+}
+
+void TrailRenderer::record(const std::vector<Particle>& particles) {
+    if (length > 0 && ++framesSinceSample < sampleInterval)
+        return;
+    framesSinceSample = 0;
+
+    head = (head + 1) % capacity;
+    length = std::min(length + 1, capacity);
+
+    threadPool.parallelFor(trailCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t trail = begin; trail < end; ++trail)
+            points[trail * capacity + head] = particles[trail * stride].position;
+    });
+}
+
+void TrailRenderer::draw(sf::RenderWindow& window, bool overHeatmap) {
+    if (length < 2)
+        return;
+
+    threadPool.parallelFor(trailCount, [&](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t trail = begin; trail < end; ++trail) {
+            const sf::Vector2f* ring = &points[trail * capacity];
+            std::size_t vertex = trail * (capacity + 2);
+            // The heatmap runs from red to white, so trails over it switch to colors it never uses
+            sf::Color color = colors[trail];
+            if (overHeatmap)
+                color = trail == 0 ? HEATMAP_FOLLOWED_COLOR : HEATMAP_TRAIL_COLOR;
+
+            // Oldest to newest; slots not yet recorded repeat the oldest point
+            std::size_t oldest = (head + capacity - length + 1) % capacity;
+            for (std::size_t i = 0; i < capacity; ++i) {
+                std::size_t age = i < capacity - length ? 0 : i - (capacity - length);
+                std::size_t slot = (oldest + age) % capacity;
+                color.a = static_cast<std::uint8_t>(255 * (age + 1) / length);
+                vertices[vertex + 1 + i] = sf::Vertex{ring[slot], color};
+            }
+
+            vertices[vertex] = sf::Vertex{ring[oldest], sf::Color::Transparent};
+            vertices[vertex + capacity + 1] = sf::Vertex{ring[head], sf::Color::Transparent};
+        }
+    });
+
+    window.draw(vertices);
+}
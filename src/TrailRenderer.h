@@ -0,0 +1,61 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRAILRENDERER_H
+#define TRAILRENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "Particle.h"
+#include "ThreadPool.h"
+
+// Motion trails kept in fixed-size ring buffers, one per followed ball.
+// All rings advance together, so they share a single head and length.
+// Storage is allocated once; recording and drawing never allocate.
+class TrailRenderer {
+private:
+    ThreadPool& threadPool;
+    std::size_t stride;       // Every stride-th ball gets a trail
+    std::size_t trailCount;
+    std::size_t capacity;     // Points per trail
+    std::size_t head;         // Slot of the newest point
+    std::size_t length;       // Points recorded so far, up to capacity
+    int sampleInterval;       // Frames between recorded points
+    int framesSinceSample;
+
+    std::vector<sf::Vector2f> points;   // trailCount rings of capacity points
+    std::vector<sf::Color> colors;      // One color per trail
+    sf::VertexArray vertices;           // One line strip for every trail
+
+public:
+    TrailRenderer(ThreadPool& threadPool, const std::vector<Particle>& particles, std::size_t capacity,
+                  std::size_t pointBudget, int sampleInterval);
+    void clear();
+    void record(const std::vector<Particle>& particles);
+    void draw(sf::RenderWindow& window, bool overHeatmap = false);
+};
+
+#endif
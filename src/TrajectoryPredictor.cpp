@@ -0,0 +1,164 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TrajectoryPredictor.h"
+#include "Particle.h"
+#include "BallType.h"
+#include <cmath>
+
+const int WINDOW_WIDTH = 1280;
+const int WINDOW_HEIGHT = 720;
+const float PIXELS_PER_M = 57.78f;
+const float GRAVITY = 9.81f * PIXELS_PER_M;
+const int STEPS_PER_SECOND = 240;              // The run's fixed step at full quality: 60 per substep, 4 substeps
+const float PREDICTION_TIMESTEP = 1.0f / STEPS_PER_SECOND;
+const int STEPS_PER_SAMPLE = 4;                // Trajectory samples once per 60 Hz frame, exactly on the step grid
+const int MAX_PREDICTED_STEPS = 120 * STEPS_PER_SECOND;
+const int CANCEL_CHECK_STEPS = 1024;           // Steps between checks for a newer request
+
+TrajectoryPredictor::TrajectoryPredictor()
+    : generation(0), hasRequest(false), stopping(false), requestedMass(0.0f), requestedHeight(0.0f) {
+    worker = std::thread(&TrajectoryPredictor::workerLoop, this);
+}
+
+TrajectoryPredictor::~TrajectoryPredictor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        ++generation;
+    }
+    requestReady.notify_one();
+    worker.join();
+}
+
+void TrajectoryPredictor::request(float mass, float height) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (requestedMass == mass && requestedHeight == height)
+            return; // Already queued, running or done
+        requestedMass = mass;
+        requestedHeight = height;
+        hasRequest = true;
+        result.reset();
+        ++generation;
+    }
+    requestReady.notify_one();
+}
+
+void TrajectoryPredictor::cancel() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (requestedMass == 0.0f && requestedHeight == 0.0f)
+        return;
+    hasRequest = false;
+    requestedMass = 0.0f;
+    requestedHeight = 0.0f;
+    result.reset();
+    ++generation;
+}
+
+std::optional<TrajectoryPrediction> TrajectoryPredictor::getResult(float mass, float height) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (result && result->mass == mass && result->height == height)
+        return result;
+    return std::nullopt;
+}
+
+void TrajectoryPredictor::workerLoop() {
+    while (true) {
+        float mass, height;
+        std::uint64_t requestGeneration;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            requestReady.wait(lock, [this] { return stopping || hasRequest; });
+            if (stopping)
+                return;
+            hasRequest = false;
+            mass = requestedMass;
+            height = requestedHeight;
+            requestGeneration = generation;
+        }
+
+        TrajectoryPrediction prediction;
+        if (!compute(mass, height, requestGeneration, prediction))
+            continue;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (generation == requestGeneration)
+            result = std::move(prediction);
+    }
+}
+
+bool TrajectoryPredictor::compute(float mass, float height, std::uint64_t requestGeneration, TrajectoryPrediction& prediction) const {
+    // Same model and step as Simulation::stepSpan for the followed ball, so predicted and measured times agree
+    const BallType& ballType = BallCatalogue::getTypes()[BallCatalogue::classify(mass)];
+    const float floorY = WINDOW_HEIGHT - ballType.pixelRadius;
+    Particle particle(WINDOW_WIDTH / 2, floorY - height * PIXELS_PER_M, mass);
+
+    prediction.mass = mass;
+    prediction.height = height;
+    prediction.sampleInterval = static_cast<float>(STEPS_PER_SAMPLE) / STEPS_PER_SECOND;
+    prediction.timeToFirstContact = 0.0f;
+    prediction.totalTime = static_cast<float>(MAX_PREDICTED_STEPS) / STEPS_PER_SECOND;
+    prediction.trajectory.clear();
+
+    bool hasTouchedGround = false;
+
+    // Time is derived from an integer step count, a running float sum would drift
+    for (int step = 0; step < MAX_PREDICTED_STEPS; ++step) {
+        if (step % CANCEL_CHECK_STEPS == 0 && step > 0 && generation != requestGeneration)
+            return false;
+
+        if (step % STEPS_PER_SAMPLE == 0) {
+            float sampleTime = prediction.trajectory.size() * prediction.sampleInterval;
+            prediction.trajectory.emplace_back(sampleTime, (floorY - particle.position.y) / PIXELS_PER_M);
+        }
+
+        sf::Vector2f gravityForce(0.f, GRAVITY * particle.mass);
+        particle.applyForce(gravityForce);
+        particle.applyDrag(PREDICTION_TIMESTEP, ballType, false);
+        particle.update(PREDICTION_TIMESTEP);
+
+        if (particle.position.y > floorY) {
+            particle.position.y = floorY;
+
+            if (!hasTouchedGround) {
+                hasTouchedGround = true;
+                prediction.timeToFirstContact = static_cast<float>(step + 1) / STEPS_PER_SECOND;
+            }
+
+            float impactSpeed = std::abs(particle.velocity.y);
+            if (impactSpeed > ballType.restSpeed + GRAVITY * PREDICTION_TIMESTEP) {
+                particle.velocity.y = -particle.velocity.y * ballType.cor;
+            } else {
+                // Resting on the floor from the next sample on, which keeps the samples evenly spaced
+                prediction.totalTime = static_cast<float>(step + 1) / STEPS_PER_SECOND;
+                prediction.trajectory.emplace_back(prediction.trajectory.size() * prediction.sampleInterval, 0.0f);
+                return true;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,77 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRAJECTORYPREDICTOR_H
+#define TRAJECTORYPREDICTOR_H
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+struct TrajectoryPrediction {
+    float mass;
+    float height;
+    std::vector<sf::Vector2f> trajectory; // (time in s, height in m), sample k is at k * sampleInterval
+    float sampleInterval;
+    float timeToFirstContact;
+    float totalTime;
+};
+
+// Simulates a single drop on a background thread while the user is still typing.
+// A new request cancels the one in flight, so only the latest candidate is computed.
+class TrajectoryPredictor {
+private:
+    std::thread worker;
+    mutable std::mutex mutex;
+    std::condition_variable requestReady;
+    std::atomic<std::uint64_t> generation;
+
+    bool hasRequest;
+    bool stopping;
+    float requestedMass;
+    float requestedHeight;
+    std::optional<TrajectoryPrediction> result;
+
+    void workerLoop();
+    bool compute(float mass, float height, std::uint64_t requestGeneration, TrajectoryPrediction& prediction) const;
+
+public:
+    TrajectoryPredictor();
+    ~TrajectoryPredictor();
+    TrajectoryPredictor(const TrajectoryPredictor&) = delete;
+    TrajectoryPredictor& operator=(const TrajectoryPredictor&) = delete;
+
+    void request(float mass, float height);
+    void cancel();
+    // The finished prediction for exactly these inputs, if there is one yet
+    std::optional<TrajectoryPrediction> getResult(float mass, float height) const;
+};
+
+#endif
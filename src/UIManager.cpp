@@ -25,23 +25,30 @@
 
 #include "UIManager.h"
 #include "Simulation.h"
+#include "BallType.h"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <algorithm>
 
 const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 const float PIXELS_PER_M = 57.78f;
 const float PADDING = 10.0f;
 const int PARTICLE_SIZE = 12;
-const float BASE_Y = WINDOW_HEIGHT - PARTICLE_SIZE;
 
 UIManager::UIManager(const sf::Font& font) : font(font),
     stopText(font, "Press Backspace to stop the simulation, 0 to reset, Esc to quit"),
     resumeText(font, "Press Enter to resume the simulation"),
     massText(font, ""),
     heightStartedText(font, ""),
-    startText(font, "Press Enter to start the simulation") {
+    startText(font, "Press Enter to start the simulation"),
+    velocityText(font, ""),
+    heightText(font, ""),
+    qualityText(font, ""),
+    predictionText(font, ""),
+    updateInterval(1),
+    framesSinceUpdate(0) {
     
     // Stop
     stopText.setCharacterSize(20);
@@ -69,37 +76,29 @@ UIManager::UIManager(const sf::Font& font) : font(font),
     startText.setOrigin(startTextOrigin);
     sf::Vector2f startTextPosition(WINDOW_WIDTH/2, WINDOW_HEIGHT/2);
     startText.setPosition(startTextPosition);
+
+    // Velocity and height, their strings are refreshed in drawSimulationUI
+    velocityText.setCharacterSize(24);
+    velocityText.setFillColor(sf::Color::Red);
+    heightText.setCharacterSize(24);
+    heightText.setFillColor(sf::Color::Red);
+
+    // Quality
+    qualityText.setCharacterSize(14);
+    qualityText.setFillColor(sf::Color::Yellow);
+
+    // Prediction
+    predictionText.setCharacterSize(20);
+    predictionText.setFillColor(sf::Color::Green);
 }
 
 void UIManager::setupUI(float mass, float height) {
     // Mass and ball info
     std::ostringstream massStream;
     massStream << std::fixed << std::setprecision(3) << mass;
-    std::string ballType;
-    if (mass <= 0.003f) // ~2.7g for a standard ping pong ball
-        ballType = " (ping pong)";
-    else if (mass <= 0.05f) // ~40g for a standard racquet ball
-        ballType = " (racquet ball)";
-    else if (mass <= 0.065f) // ~56-59.4g for a standard tennis ball
-        ballType = " (tennis ball)";
-    else if (mass <= 0.16f) // ~142-149g for a standard baseball
-        ballType = " (baseball)";
-    else if (mass <= 0.5f) // ~410-450g for a standard size 5 soccer ball
-        ballType = " (soccer ball)";
-    else if (mass <= 0.7f) // ~567-650g for a standard size 7 basketball
-        ballType = " (basketball)";
-    else if (mass <= 8.0f) // Up to ~7.26kg for a heavy bowling ball or shot put
-        ballType = " (bowling ball)";
-    else if (mass <= 20.0f) // Common range for heavier medicine balls
-        ballType = " (light medicine ball)";
-    else if (mass <= 50.0f) // Range for very heavy medicine balls or specialized training balls
-        ballType = " (heavy medicine ball)";
-    else if (mass <= 100.0f) // Up to 100kg for extremely heavy training balls or industrial spherical objects
-        ballType = " (industrial ball)";
-    else // For any mass greater than 100kg
-        ballType = " (extremely heavy / undefined ball)";
+    const BallType& ballType = BallCatalogue::getTypes()[BallCatalogue::classify(mass)];
     
-    std::string massString = "Mass: " + massStream.str() + " kg" + ballType;
+    std::string massString = "Mass: " + massStream.str() + " kg (" + ballType.name + ")";
     massText = sf::Text(font, massString);
     massText.setCharacterSize(20);
     massText.setFillColor(sf::Color::White);
@@ -126,31 +125,46 @@ void UIManager::setupUI(float mass, float height) {
 void UIManager::drawStartScreen(sf::RenderWindow& window) {
     window.clear();
     window.draw(startText);
+    window.draw(predictionText);
     window.display();
 }
 
+void UIManager::setPrediction(const std::string& prediction) {
+    predictionText.setString(prediction);
+    sf::FloatRect predictionTextBounds = predictionText.getLocalBounds();
+    sf::Vector2f predictionTextOrigin(predictionTextBounds.position.x + predictionTextBounds.size.x/2, predictionTextBounds.position.y);
+    predictionText.setOrigin(predictionTextOrigin);
+    sf::Vector2f predictionTextPosition(WINDOW_WIDTH/2, WINDOW_HEIGHT/2 + PADDING*4);
+    predictionText.setPosition(predictionTextPosition);
+}
+
 void UIManager::drawSimulationUI(sf::RenderWindow& window, const Particle& particle) {
     int digitsAfterComma = 2;
 
-    // Velocity
-    std::stringstream ssVelocity;
-    ssVelocity << std::fixed << std::setprecision(digitsAfterComma) << (particle.velocity.y / PIXELS_PER_M);
-    std::string velocityString = ssVelocity.str() + " m/s";
-    sf::Text velocityText(font, velocityString);
-    velocityText.setCharacterSize(24);
-    velocityText.setFillColor(sf::Color::Red);
-    sf::Vector2f velocityTextPosition = particle.position + sf::Vector2f(PARTICLE_SIZE, -PARTICLE_SIZE);
+    // Readouts are reformatted every updateInterval frames, positions follow the ball every frame
+    if (++framesSinceUpdate >= updateInterval) {
+        framesSinceUpdate = 0;
+
+        // Velocity
+        std::stringstream ssVelocity;
+        ssVelocity << std::fixed << std::setprecision(digitsAfterComma) << (particle.velocity.y / PIXELS_PER_M);
+        velocityText.setString(ssVelocity.str() + " m/s");
+
+        // Height
+        std::stringstream ssHeight;
+        float floorY = WINDOW_HEIGHT - BallCatalogue::getTypes()[particle.type].pixelRadius;
+        float height = (floorY - particle.position.y) / PIXELS_PER_M;
+        ssHeight << std::fixed << std::setprecision(digitsAfterComma) << (height);
+        heightText.setString(ssHeight.str() + " m");
+    }
+
+    // Labels sit at the top right of the drawn ball, which is at least PARTICLE_SIZE and rests on the floor
+    float radius = BallCatalogue::getTypes()[particle.type].pixelRadius;
+    float drawRadius = std::max(radius, static_cast<float>(PARTICLE_SIZE));
+    sf::Vector2f labelOffset(drawRadius, radius - 2.0f * drawRadius);
+    sf::Vector2f velocityTextPosition = particle.position + labelOffset;
     velocityText.setPosition(velocityTextPosition);
-
-    // Height
-    std::stringstream ssHeight;
-    float height = -((particle.position.y - BASE_Y) / PIXELS_PER_M);
-    ssHeight << std::fixed << std::setprecision(digitsAfterComma) << (height);
-    std::string heightString = ssHeight.str() + " m";
-    sf::Text heightText(font, heightString);
-    heightText.setCharacterSize(24);
-    heightText.setFillColor(sf::Color::Red);
-    sf::Vector2f heightTextPosition = particle.position + sf::Vector2f(PARTICLE_SIZE, -PARTICLE_SIZE-20);
+    sf::Vector2f heightTextPosition = particle.position + labelOffset + sf::Vector2f(0.f, -20.f);
     heightText.setPosition(heightTextPosition);
 
     window.draw(velocityText);
@@ -165,6 +179,27 @@ void UIManager::drawPauseScreen(sf::RenderWindow& window) {
     window.display();
 }
 
+void UIManager::drawControls(sf::RenderWindow& window) {
+    window.draw(stopText);
+}
+
+void UIManager::setUpdateInterval(int frames) {
+    updateInterval = std::max(frames, 1);
+}
+
+void UIManager::setQualityNotice(const std::string& notice) {
+    qualityText.setString(notice);
+    sf::FloatRect qualityTextBounds = qualityText.getLocalBounds();
+    sf::Vector2f qualityTextOrigin(qualityTextBounds.position.x + qualityTextBounds.size.x, qualityTextBounds.position.y + qualityTextBounds.size.y);
+    qualityText.setOrigin(qualityTextOrigin);
+    sf::Vector2f qualityTextPosition(WINDOW_WIDTH - PADDING, WINDOW_HEIGHT - PADDING);
+    qualityText.setPosition(qualityTextPosition);
+}
+
+void UIManager::drawQualityNotice(sf::RenderWindow& window) {
+    window.draw(qualityText);
+}
+
 void UIManager::drawTime(sf::RenderWindow& window, const Particle& particle, const std::string& timeString) {
     sf::Text timeText(font, timeString);
     timeText.setCharacterSize(24);
@@ -192,4 +227,5 @@ void UIManager::drawFinishedScreen(sf::RenderWindow& window, const Particle& par
     window.draw(massText);
     window.draw(heightStartedText);
     window.draw(finishedTimeText);
+    window.draw(predictionText);
 }
\ No newline at end of file
@@ -37,6 +37,12 @@ private:
     sf::Text massText;
     sf::Text heightStartedText;
     sf::Text startText;
+    sf::Text velocityText;
+    sf::Text heightText;
+    sf::Text qualityText;
+    sf::Text predictionText;
+    int updateInterval;
+    int framesSinceUpdate;
 
 public:
     UIManager(const sf::Font& font);
@@ -44,6 +50,11 @@ public:
     void drawStartScreen(sf::RenderWindow& window);
     void drawSimulationUI(sf::RenderWindow& window, const Particle& particle);
     void drawPauseScreen(sf::RenderWindow& window);
+    void drawControls(sf::RenderWindow& window);
+    void setUpdateInterval(int frames);
+    void setPrediction(const std::string& prediction);
+    void setQualityNotice(const std::string& notice);
+    void drawQualityNotice(sf::RenderWindow& window);
     void drawTime(sf::RenderWindow& window, const Particle& particle, const std::string& timeString);
     void drawFinishedScreen(sf::RenderWindow& window, const Particle& particle, const std::string& finishedTimeString);
 };
@@ -0,0 +1,164 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "WindField.h"
+#include <algorithm>
+#include <cmath>
+
+const int WINDOW_WIDTH = 1280;
+const int WINDOW_HEIGHT = 720;
+const float PI = 3.14159265359f;
+const float CELL_SIZE = 4.0f;      // Pixels per cell when the grid is built from updrafts alone
+const std::size_t TILE_SIZE = 16;  // Cells per tile side
+const float ARROW_SPACING = 64.0f;
+const float ARROW_SCALE = 0.1f;    // Seconds of air motion shown by each arrow
+
+WindField::WindField(const WindConfig& config)
+    : columns(0), rows(0), tileColumns(0), tileRows(0), cellWidth(CELL_SIZE), cellHeight(CELL_SIZE),
+      baseWind(config.velocity), gust(config.gust), gustPeriod(config.gustPeriod), time(0.0f),
+      currentWind(config.velocity), arrowVertices(sf::PrimitiveType::Lines) {
+
+    bool hasGrid = config.columns > 0 && config.rows > 0;
+    active = hasGrid || !config.updrafts.empty() || baseWind != sf::Vector2f(0.f, 0.f);
+    if (!hasGrid && config.updrafts.empty())
+        return; // Uniform wind needs no grid
+
+    // A grid from a file keeps its own resolution and is stretched over the window
+    columns = hasGrid ? config.columns : static_cast<std::size_t>(std::ceil(WINDOW_WIDTH / CELL_SIZE));
+    rows = hasGrid ? config.rows : static_cast<std::size_t>(std::ceil(WINDOW_HEIGHT / CELL_SIZE));
+    cellWidth = static_cast<float>(WINDOW_WIDTH) / columns;
+    cellHeight = static_cast<float>(WINDOW_HEIGHT) / rows;
+    tileColumns = (columns + TILE_SIZE - 1) / TILE_SIZE;
+    tileRows = (rows + TILE_SIZE - 1) / TILE_SIZE;
+    cells.assign(tileColumns * tileRows * TILE_SIZE * TILE_SIZE, AirSample());
+
+    for (std::size_t row = 0; row < rows; ++row) {
+        for (std::size_t column = 0; column < columns; ++column) {
+            AirSample& cell = cells[cellIndex(column, row)];
+            if (hasGrid) {
+                cell.velocity = config.gridVelocity[row * columns + column];
+                cell.density = config.gridDensity[row * columns + column];
+            }
+
+            float x = (column + 0.5f) * cellWidth;
+            for (const Updraft& updraft : config.updrafts) {
+                float distance = (x - updraft.x) / updraft.width;
+                cell.velocity.y -= updraft.speed * std::exp(-distance * distance);
+            }
+        }
+    }
+}
+
+std::size_t WindField::cellIndex(std::size_t column, std::size_t row) const {
+    std::size_t tile = (row / TILE_SIZE) * tileColumns + column / TILE_SIZE;
+    return tile * TILE_SIZE * TILE_SIZE + (row % TILE_SIZE) * TILE_SIZE + column % TILE_SIZE;
+}
+
+bool WindField::isEmpty() const {
+    return !active;
+}
+
+void WindField::advance(float deltaTime) {
+    time += deltaTime;
+    float scale = gustPeriod > 0.0f ? 1.0f + gust * std::sin(2.0f * PI * time / gustPeriod) : 1.0f;
+    currentWind = baseWind * scale;
+}
+
+void WindField::reset() {
+    time = 0.0f;
+    currentWind = baseWind;
+}
+
+std::size_t WindField::getTileCount() const {
+    return std::max<std::size_t>(tileColumns * tileRows, 1);
+}
+
+std::size_t WindField::getTile(sf::Vector2f position) const {
+    if (cells.empty())
+        return 0;
+    float column = std::clamp(position.x / cellWidth, 0.0f, static_cast<float>(columns - 1));
+    float row = std::clamp(position.y / cellHeight, 0.0f, static_cast<float>(rows - 1));
+    return (static_cast<std::size_t>(row) / TILE_SIZE) * tileColumns + static_cast<std::size_t>(column) / TILE_SIZE;
+}
+
+void WindField::sample(const Particle* particles, std::size_t count, AirSample* samples) const {
+    if (cells.empty()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            samples[i] = AirSample();
+            samples[i].velocity = currentWind;
+        }
+        return;
+    }
+
+    const float maxColumn = static_cast<float>(columns - 1);
+    const float maxRow = static_cast<float>(rows - 1);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        // Cell centers sit half a cell in, positions outside the window take the edge value
+        float x = std::clamp(particles[i].position.x / cellWidth - 0.5f, 0.0f, maxColumn);
+        float y = std::clamp(particles[i].position.y / cellHeight - 0.5f, 0.0f, maxRow);
+        std::size_t column0 = static_cast<std::size_t>(x);
+        std::size_t row0 = static_cast<std::size_t>(y);
+        std::size_t column1 = std::min(column0 + 1, columns - 1);
+        std::size_t row1 = std::min(row0 + 1, rows - 1);
+        float fx = x - column0;
+        float fy = y - row0;
+
+        const AirSample& topLeft = cells[cellIndex(column0, row0)];
+        const AirSample& topRight = cells[cellIndex(column1, row0)];
+        const AirSample& bottomLeft = cells[cellIndex(column0, row1)];
+        const AirSample& bottomRight = cells[cellIndex(column1, row1)];
+
+        float w00 = (1.0f - fx) * (1.0f - fy);
+        float w10 = fx * (1.0f - fy);
+        float w01 = (1.0f - fx) * fy;
+        float w11 = fx * fy;
+
+        samples[i].velocity = topLeft.velocity * w00 + topRight.velocity * w10
+                            + bottomLeft.velocity * w01 + bottomRight.velocity * w11 + currentWind;
+        samples[i].density = topLeft.density * w00 + topRight.density * w10
+                           + bottomLeft.density * w01 + bottomRight.density * w11;
+    }
+}
+
+void WindField::draw(sf::RenderWindow& window) {
+    if (!active)
+        return;
+
+    // Coarse arrows of the current air velocity, sampled through a dummy particle
+    const sf::Color color(90, 140, 200, 120);
+    arrowVertices.clear();
+    Particle probe(0.0f, 0.0f, 1.0f);
+    for (float y = ARROW_SPACING / 2; y < WINDOW_HEIGHT; y += ARROW_SPACING) {
+        for (float x = ARROW_SPACING / 2; x < WINDOW_WIDTH; x += ARROW_SPACING) {
+            probe.position = sf::Vector2f(x, y);
+            AirSample air;
+            sample(&probe, 1, &air);
+            arrowVertices.append(sf::Vertex{probe.position, color});
+            arrowVertices.append(sf::Vertex{probe.position + air.velocity * ARROW_SCALE, color});
+        }
+    }
+    window.draw(arrowVertices);
+}
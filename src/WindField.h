@@ -0,0 +1,72 @@
+/*
+ * Gravr -- Simulating physics with SFML.
+ * 
+ * MIT License
+ * Copyright (c) 2025 Alessandro Chitarrini
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef WINDFIELD_H
+#define WINDFIELD_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "Particle.h"
+#include "SceneLoader.h"
+
+// Air velocity and density over the window, sampled bilinearly.
+// Cells are stored in square tiles laid out one after another, so balls that
+// were sorted by tile read from a few kilobytes of the grid at a time.
+// A uniform wind with gusts is added on top of the grid as it changes over time.
+class WindField {
+private:
+    std::size_t columns;
+    std::size_t rows;
+    std::size_t tileColumns;
+    std::size_t tileRows;
+    float cellWidth;     // Pixels per cell
+    float cellHeight;
+    std::vector<AirSample> cells;
+
+    sf::Vector2f baseWind;
+    float gust;
+    float gustPeriod;
+    float time;
+    sf::Vector2f currentWind; // baseWind scaled by the gust at the current time
+    bool active;
+
+    sf::VertexArray arrowVertices;
+
+    std::size_t cellIndex(std::size_t column, std::size_t row) const;
+
+public:
+    explicit WindField(const WindConfig& config = WindConfig());
+    bool isEmpty() const;
+    void advance(float deltaTime);
+    void reset();
+    std::size_t getTileCount() const;
+    std::size_t getTile(sf::Vector2f position) const;
+    // Bilinear samples for count consecutive particles
+    void sample(const Particle* particles, std::size_t count, AirSample* samples) const;
+    void draw(sf::RenderWindow& window);
+};
+
+#endif
@@ -25,15 +25,74 @@
 
 #include <SFML/Graphics.hpp>
 #include "Simulation.h"
+#include "ComparisonSimulation.h"
+#include "FontLoader.h"
+#include "SceneLoader.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <utility>
 
 const int WINDOW_WIDTH = 1280;
 const int WINDOW_HEIGHT = 720;
 
-int main() {
+int main(int argc, char* argv[]) {
+    std::size_t ballCount = 1;
+    std::string scenePath;
+    float frameBudgetMs = 16.6f;
+
+    // Positional arguments: ball count, scene file. Options: --budget=<ms>
+    int position = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument.rfind("--budget=", 0) == 0) {
+            float parsed = 0.0f;
+            try {
+                parsed = std::stof(argument.substr(9));
+            } catch (...) {
+            }
+            // Also rejects NaN, which fails every comparison
+            if (parsed > 0.0f && std::isfinite(parsed)) {
+                frameBudgetMs = parsed;
+            } else {
+                frameBudgetMs = 16.6f;
+                std::cerr << "Invalid frame budget, using 16.6 ms\n";
+            }
+        } else if (position == 0) {
+            ++position;
+            // stoul accepts a leading minus and wraps it, so only plain digits are taken
+            std::size_t parsed = 0;
+            try {
+                if (!argument.empty() && argument.find_first_not_of("0123456789") == std::string::npos)
+                    ballCount = std::stoul(argument, &parsed);
+            } catch (...) {
+            }
+            if (parsed == 0 || parsed != argument.size()) {
+                ballCount = 1;
+                std::cerr << "Invalid ball count, using a single ball\n";
+            }
+        } else if (position == 1) {
+            ++position;
+            scenePath = argument;
+        }
+    }
+
+    Scene scene;
+    if (!scenePath.empty()) {
+        scene = SceneLoader::load(scenePath);
+    }
+
     sf::RenderWindow window = sf::RenderWindow(sf::VideoMode({WINDOW_WIDTH, WINDOW_HEIGHT}), "Gravr");
-    sf::Font font("../assets/fonts/RobotoMono-Regular.ttf");
+    sf::Font font = FontLoader::load();
+    FontLoader::preloadGlyphs(font);
     
-    Simulation simulation(window, font);
+    if (!scene.lanes.empty()) {
+        ComparisonSimulation comparison(window, font, scene.lanes);
+        comparison.run();
+        return 0;
+    }
+
+    Simulation simulation(window, font, ballCount, std::move(scene), frameBudgetMs);
     simulation.run();
 
     return 0;